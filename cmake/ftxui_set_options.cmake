@@ -44,6 +44,11 @@ function(ftxui_set_options library)
     target_compile_definitions(${library}
       PRIVATE "FTXUI_MICROSOFT_TERMINAL_FALLBACK")
   endif()
+
+  if (FTXUI_ENABLE_PROFILING)
+    target_compile_definitions(${library}
+      PRIVATE "FTXUI_ENABLE_PROFILING")
+  endif()
 endfunction()
 
 if (EMSCRIPTEN)
@@ -14,15 +14,40 @@ add_executable(tests
   src/ftxui/component/component_test.cpp
   src/ftxui/component/container_test.cpp
   src/ftxui/component/input_test.cpp
+  src/ftxui/component/line_index_test.cpp
+  src/ftxui/component/pager_test.cpp
   src/ftxui/component/radiobox_test.cpp
   src/ftxui/component/receiver_test.cpp
   src/ftxui/component/screen_interactive_test.cpp
   src/ftxui/component/terminal_input_parser_test.cpp
   src/ftxui/component/toggle_test.cpp
+  src/ftxui/component/trigram_index_test.cpp
+  src/ftxui/dom/code_buffer_test.cpp
+  src/ftxui/dom/dbox_test.cpp
   src/ftxui/dom/gauge_test.cpp
+  src/ftxui/dom/gradient_test.cpp
+  src/ftxui/dom/gridbox_test.cpp
   src/ftxui/dom/hbox_test.cpp
+  src/ftxui/dom/heatmap_test.cpp
+  src/ftxui/dom/image_test.cpp
+  src/ftxui/dom/node_test.cpp
+  src/ftxui/dom/offscreen_test.cpp
+  src/ftxui/dom/parallel_test.cpp
+  src/ftxui/dom/profiled_node_test.cpp
+  src/ftxui/dom/reconciler_test.cpp
+  src/ftxui/dom/sample_buffer_test.cpp
+  src/ftxui/dom/sparkline_test.cpp
+  src/ftxui/dom/spans_test.cpp
+  src/ftxui/dom/structural_hash_test.cpp
+  src/ftxui/dom/style_test.cpp
   src/ftxui/dom/text_test.cpp
   src/ftxui/dom/vbox_test.cpp
+  src/ftxui/dom/vgrid_test.cpp
+  src/ftxui/screen/color_info_test.cpp
+  src/ftxui/screen/interned_string_test.cpp
+  src/ftxui/screen/profiler_test.cpp
+  src/ftxui/screen/row_writer_test.cpp
+  src/ftxui/util/small_vector_test.cpp
 )
 
 target_link_libraries(tests
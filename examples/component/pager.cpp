@@ -0,0 +1,31 @@
+#include <iostream>  // for operator<<, endl, basic_ostream, cerr
+#include <memory>    // for allocator, __shared_ptr_access
+
+#include "ftxui/component/component.hpp"          // for Pager
+#include "ftxui/component/component_options.hpp"  // for PagerOption
+#include "ftxui/component/event.hpp"              // for Event, Event::Custom
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+
+using namespace ftxui;
+
+int main(int argc, const char* argv[]) {
+  if (argc != 2) {
+    std::cerr << "Usage: " << argv[0] << " <file>" << std::endl;
+    return 1;
+  }
+
+  auto screen = ScreenInteractive::Fullscreen();
+
+  // Update the line count displayed while the file is being indexed, and the
+  // matches once they are found.
+  PagerOption option;
+  option.on_index_progress = [&] { screen.PostEvent(Event::Custom); };
+  option.on_search_done = [&] { screen.PostEvent(Event::Custom); };
+
+  screen.Loop(Pager(argv[1], &option));
+  return 0;
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -65,7 +65,7 @@ int main(int argc, const char* argv[]) {
         border | size(HEIGHT, GREATER_THAN, 40);
 
     auto screen = Screen::Create(Dimension::Full(), Dimension::Fit(document));
-    Render(screen, document);
+    RenderMeasured(screen, document);
     std::cout << reset_position;
     screen.Print();
     reset_position = screen.ResetPosition();
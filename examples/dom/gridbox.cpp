@@ -0,0 +1,40 @@
+#include <stdio.h>                 // for getchar
+#include <ftxui/dom/elements.hpp>  // for operator|, text, Element, gridbox, border, flex, center
+#include <ftxui/screen/screen.hpp>  // for Dimension, Screen
+#include <memory>                   // for allocator
+
+#include "ftxui/dom/node.hpp"    // for Render
+#include "ftxui/screen/box.hpp"  // for ftxui
+
+int main(int argc, const char* argv[]) {
+  using namespace ftxui;
+  auto cell = [](const wchar_t* t) { return text(t) | center | border; };
+  auto document =  //
+      gridbox({
+          {
+              cell(L"north-west"),
+              cell(L"north"),
+              cell(L"north-east"),
+          },
+          {
+              cell(L"west"),
+              cell(L"center") | flex,
+              cell(L"east"),
+          },
+          {
+              cell(L"south-west"),
+              cell(L"south"),
+              cell(L"south-east"),
+          },
+      });
+  auto screen = Screen::Create(Dimension::Full(), Dimension::Fit(document));
+  Render(screen, document);
+  screen.Print();
+  getchar();
+
+  return 0;
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
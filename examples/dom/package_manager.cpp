@@ -129,7 +129,7 @@ int main(int argc, const char* argv[]) {
     // Draw.
     auto document = render();
     auto screen = Screen::Create(Dimension::Full(), Dimension::Fit(document));
-    Render(screen, document);
+    RenderMeasured(screen, document);
     std::cout << reset_position;
     screen.Print();
     reset_position = screen.ResetPosition();
@@ -33,7 +33,7 @@ int main(int argc, const char* argv[]) {
         filler(),
     });
     auto screen = Screen::Create(Dimension::Full(), Dimension::Fit(document));
-    Render(screen, document);
+    RenderMeasured(screen, document);
     std::cout << reset_position;
     screen.Print();
     reset_position = screen.ResetPosition();
@@ -3,7 +3,7 @@
 
 #include <functional>  // for function
 #include <memory>      // for shared_ptr, make_shared
-#include <string>      // for wstring
+#include <string>      // for string, wstring
 #include <vector>      // for vector
 
 #include "ftxui/component/component_base.hpp"
@@ -19,6 +19,7 @@ struct ButtonOption;
 struct CheckboxOption;
 struct InputOption;
 struct MenuOption;
+struct PagerOption;
 struct RadioboxOption;
 struct ToggleOption;
 
@@ -42,12 +43,22 @@ Component Input(StringRef content,
 Component Menu(const std::vector<std::wstring>* entries,
                int* selected_,
                Ref<MenuOption> = {});
+Component Menu(const std::vector<InternedString>* entries,
+               int* selected_,
+               Ref<MenuOption> = {});
+Component Pager(const std::string& path, Ref<PagerOption> option = {});
 Component Radiobox(const std::vector<std::wstring>* entries,
                    int* selected_,
                    Ref<RadioboxOption> option = {});
+Component Radiobox(const std::vector<InternedString>* entries,
+                   int* selected_,
+                   Ref<RadioboxOption> option = {});
 Component Toggle(const std::vector<std::wstring>* entries,
                  int* selected,
                  Ref<ToggleOption> option = {});
+Component Toggle(const std::vector<InternedString>* entries,
+                 int* selected,
+                 Ref<ToggleOption> option = {});
 template <class T>  // T = {int, float, long}
 Component Slider(StringRef label, T* value, T min, T max, T increment);
 Component ResizableSplitLeft(Component main, Component back, int* main_size);
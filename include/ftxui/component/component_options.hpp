@@ -53,6 +53,16 @@ struct InputOption {
   Ref<int> cursor_position = 0;
 };
 
+/// @brief Option for the Pager component.
+/// @ingroup component
+struct PagerOption {
+  /// Called from the indexing thread, when more lines have been indexed.
+  std::function<void()> on_index_progress = [] {};
+
+  /// Called from the searching thread, when the matches of a search are found.
+  std::function<void()> on_search_done = [] {};
+};
+
 /// @brief Option for the Radiobox component.
 /// @ingroup component
 struct RadioboxOption {
@@ -1,6 +1,7 @@
 #ifndef FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
+#include <stdint.h>                      // for uint64_t
 #include <atomic>                        // for atomic
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
@@ -32,7 +33,7 @@ class ScreenInteractive : public Screen {
   CapturedMouse CaptureMouse();
 
  private:
-  void Draw(Component component);
+  bool Draw(Component component);
   void EventLoop(Component component);
 
   enum class Dimension {
@@ -60,6 +61,10 @@ class ScreenInteractive : public Screen {
   int cursor_y_ = 1;
 
   bool mouse_captured = false;
+
+  // The hash of the document drawn last, see Node::Hash().
+  bool previous_frame_hashed_ = false;
+  uint64_t previous_frame_hash_ = 0;
 };
 
 }  // namespace ftxui
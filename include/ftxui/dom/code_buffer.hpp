@@ -0,0 +1,99 @@
+#ifndef FTXUI_DOM_CODE_BUFFER_HPP
+#define FTXUI_DOM_CODE_BUFFER_HPP
+
+#include <stdint.h>    // for uint64_t
+#include <functional>  // for function
+#include <mutex>       // for mutex
+#include <string>      // for wstring
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"  // for Span
+
+namespace ftxui {
+
+/// @brief The lines of a text, highlighted by a lexer. They are displayed by
+/// code_view().
+/// @ingroup dom
+///
+/// The state of the lexer at the beginning of every line is cached. Only the
+/// displayed lines are tokenized into runs, from their cached state. After an
+/// edit, the states are computed again from the modified line, until they are
+/// the same as before the edit.
+///
+/// Several code_view elements can display the same buffer, e.g. a split view.
+/// They may be drawn in parallel, see SetRenderThreads(): Highlight() can be
+/// called from several threads. The edits must not happen while drawing.
+///
+/// ### Example
+///
+/// ```cpp
+/// // The state is 1 inside of a /* comment */.
+/// auto lexer = [](const std::wstring& line, int state,
+///                 std::vector<Span>* spans) {
+///   ...
+///   return state;
+/// };
+/// auto code = std::make_shared<CodeBuffer>(lexer, lines);
+///
+/// Element document = code_view(code, cursor_line) | yframe;
+/// ```
+class CodeBuffer {
+ public:
+  // Tokenize |line|, which begins in |state|. Append its runs to |spans|, and
+  // return the state at the end of the line. The first line begins in 0.
+  using Lexer = std::function<
+      int(const std::wstring& line, int state, std::vector<Span>* spans)>;
+
+  explicit CodeBuffer(Lexer lexer, std::vector<std::wstring> lines = {});
+
+  int size() const { return int(lines_.size()); }
+  const std::wstring& line(int index) const { return lines_[index]; }
+
+  // Edit the lines. Nothing is tokenized until the next Highlight().
+  void Set(int index, std::wstring line);
+  void Insert(int index, std::wstring line);
+  void Erase(int index);
+
+  // Replace |spans| by the runs of the line |index|. The lexer is called with
+  // a lock held.
+  void Highlight(int index, std::vector<Span>* spans);
+
+  // Incremented by every edit.
+  uint64_t version() const { return version_; }
+
+  // The number of lines tokenized so far, to check the cache works.
+  uint64_t tokenized() const { return tokenized_; }
+
+ private:
+  int State(int index);
+  // Append the runs of the line |index| to |spans|. It must begin in a valid
+  // state. Its end state is stored when it's the first unknown one.
+  void Tokenize(int index, std::vector<Span>* spans);
+
+  Lexer lexer_;
+  std::vector<std::wstring> lines_;
+
+  // states_[i] is the state at the beginning of the line i, and the last one
+  // the state at the end of the text. The first |valid_| ones are up to date.
+  // After them, states_[i + 1] is the state at the end of the line i from
+  // states_[i], unless dirty_[i]: the line i changed since, or was never
+  // tokenized. So once a state is found equal to the one before an edit, the
+  // next ones are up to date until the next dirty line.
+  std::vector<int> states_;
+  std::vector<bool> dirty_;
+  int valid_ = 1;
+
+  // Guards the states and the counters, updated by Highlight().
+  std::mutex mutex_;
+  std::vector<Span> discarded_;
+  uint64_t version_ = 0;
+  uint64_t tokenized_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_CODE_BUFFER_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -7,10 +7,15 @@
 #include "ftxui/dom/node.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
+#include "ftxui/screen/color_map.hpp"
+#include "ftxui/screen/interned_string.hpp"
 #include "ftxui/screen/screen.hpp"
 
 namespace ftxui {
 class Node;
+class CodeBuffer;
+class Image;
+class SampleBuffer;
 using Element = std::shared_ptr<Node>;
 using Elements = std::vector<Element>;
 using Decorator = std::function<Element(Element)>;
@@ -24,8 +29,39 @@ Element operator|(Element, Decorator);
 Elements operator|(Elements, Decorator);
 Decorator operator|(Decorator, Decorator);
 
+// A run of text sharing the same style, see spans(). Color::Default keeps the
+// color below.
+struct Span {
+  std::wstring text;
+  Color foreground = Color::Default;
+  Color background = Color::Default;
+  bool bold = false;
+  bool dim = false;
+  bool inverted = false;
+  bool underlined = false;
+  bool blink = false;
+};
+
+// The options of vgrid(). The size of a row or a column is given by a function,
+// or measured from its visible cells when the function is empty. It is at least
+// one cell.
+struct VGridOption {
+  std::function<int(int row)> row_height = [](int) { return 1; };
+  std::function<int(int column)> column_width;
+
+  // The first rows and columns, always displayed.
+  int frozen_rows = 0;
+  int frozen_columns = 0;
+
+  // The first row and column displayed after the frozen ones.
+  int top = 0;
+  int left = 0;
+};
+
 // --- Widget ---
 Element text(std::wstring text);
+Element text(InternedString text);
+Element text(InternedString prefix, InternedString text);
 Element vtext(std::wstring text);
 Element separator(void);
 Element separator(Pixel);
@@ -35,7 +71,15 @@ Decorator borderWith(Pixel);
 Element window(Element title, Element content);
 Element spinner(int charset_index, size_t image_index);
 Elements paragraph(std::wstring text);  // Use inside hflow(). Split by space.
+Element spans(std::vector<Span> runs);
+Element spans_wrapped(std::vector<Span> runs);  // Split by space.
 Element graph(GraphFunction);
+Element sparkline(std::shared_ptr<SampleBuffer>);
+Element streaming_graph(std::shared_ptr<SampleBuffer>);
+Element heatmap(std::vector<std::vector<float>> values, ColorMap);
+Element heatmap_half_block(std::vector<std::vector<float>> values, ColorMap);
+Element image(Image);
+Element code_view(std::shared_ptr<CodeBuffer>, int selected_line = 0);
 
 // -- Decorator ---
 Element bold(Element);
@@ -47,6 +91,12 @@ Decorator color(Color);
 Decorator bgcolor(Color);
 Element color(Color, Element);
 Element bgcolor(Color, Element);
+Decorator color_gradient(float angle, Color from, Color to);
+Decorator bgcolor_gradient(float angle, Color from, Color to);
+Decorator color_radial_gradient(Color center, Color edge);
+Decorator bgcolor_radial_gradient(Color center, Color edge);
+Decorator color_blend(Color, float alpha);
+Decorator bgcolor_blend(Color, float alpha);
 
 // --- Layout is
 // Horizontal, Vertical or stacked set of elements.
@@ -54,6 +104,11 @@ Element hbox(Elements);
 Element vbox(Elements);
 Element dbox(Elements);
 Element hflow(Elements);
+Element gridbox(std::vector<Elements> lines);
+Element vgrid(int rows,
+              int columns,
+              std::function<Element(int row, int column)> cell,
+              VGridOption option = {});
 
 // -- Flexibility ---
 // Define how to share the remaining space when not all of it is used inside a
@@ -0,0 +1,64 @@
+#ifndef FTXUI_DOM_IMAGE_HPP
+#define FTXUI_DOM_IMAGE_HPP
+
+#include <stdint.h>  // for uint8_t
+#include <memory>    // for shared_ptr
+#include <vector>    // for vector
+
+namespace ftxui {
+
+// How an Image is drawn.
+struct ImageOption {
+  enum Mode {
+    HalfBlock,  // 1x2 pixels per cell, using ▀.
+    Quadrant,   // 2x2 pixels per cell, approximated by two colors.
+  };
+  Mode mode = HalfBlock;
+
+  // How the colors missing from the palette of the terminal are approximated.
+  // Ignored with the true colors.
+  enum Dithering {
+    None,
+    Ordered,
+    FloydSteinberg,
+  };
+  Dithering dithering = None;
+};
+
+/// @brief An RGB image, displayed by image().
+/// @ingroup dom
+///
+/// It is scaled to the box it is given, keeping its aspect ratio. The cells
+/// drawn for the last box sizes are kept, so that drawing the same image at the
+/// same size again costs a copy. Copying an Image shares them: keep it around
+/// instead of building it at every frame.
+///
+/// ### Example
+///
+/// ```cpp
+/// Image thumbnail(LoadRGB("plot.ppm"), 640, 480);
+/// Element document = image(thumbnail) | size(WIDTH, EQUAL, 40);
+/// ```
+class Image {
+ public:
+  // |rgb| holds 3 bytes per pixel, line by line.
+  Image(std::vector<uint8_t> rgb, int width, int height, ImageOption = {});
+
+  int width() const;
+  int height() const;
+  const ImageOption& option() const;
+
+  struct Data;
+  const std::shared_ptr<Data>& data() const { return data_; }
+
+ private:
+  std::shared_ptr<Data> data_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_IMAGE_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
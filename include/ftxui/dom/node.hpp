@@ -1,12 +1,15 @@
 #ifndef FTXUI_DOM_NODE_HPP
 #define FTXUI_DOM_NODE_HPP
 
+#include <iosfwd>  // for ostream
 #include <memory>  // for shared_ptr
 #include <vector>  // for vector
 
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/requirement.hpp"      // for Requirement
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
 #include "ftxui/screen/screen.hpp"
+#include "ftxui/util/small_vector.hpp"  // for SmallVector
 
 namespace ftxui {
 
@@ -18,7 +21,12 @@ using Elements = std::vector<std::shared_ptr<Node>>;
 
 class Node {
  public:
+  // Most nodes have one or two children. Those are stored without allocating
+  // memory.
+  using Children = SmallVector<Element, 2>;
+
   Node();
+  Node(Element child);
   Node(Elements children);
   virtual ~Node();
 
@@ -31,19 +39,63 @@ class Node {
   // Step 2: Assign this element its final dimensions.
   //         Propagated from Parents to Children.
   virtual void SetBox(Box box);
+  // The box assigned by the last SetBox(). It is uninitialized until then:
+  // check box_known() first when the node may not have been laid out, e.g. an
+  // overridden SetBox() doesn't call Node::SetBox().
+  Box box() const { return box_; }
+  bool box_known() const { return box_known_; }
 
   // Step 3: Draw this element.
   virtual void Render(Screen& screen);
+  // Whether Render() skips the children outside of the screen's stencil, like
+  // the containers using RenderDisjoint(). Drawing such an element once per
+  // part of an area costs about the same as drawing it once.
+  virtual bool CullsByStencil() const { return false; }
+
+  // Optional: Add to |hash| everything this element and its children display.
+  //           A document whose hash didn't change since the previous frame
+  //           isn't drawn again. Returns false when this element can't be
+  //           hashed, e.g. it draws using a callback: the document is then
+  //           always drawn.
+  virtual bool Hash(StructuralHash& hash);
 
  protected:
-  std::vector<Element> children_;
+  // Add the type of this node and its children to |hash|. This is the whole
+  // Hash() of the nodes without a state of their own.
+  bool HashChildren(StructuralHash& hash);
+
+  Children children_;
   Requirement requirement_;
   Box box_;
+
+ private:
+  bool box_known_ = false;
+
+  // Measures the calls of the children, see ftxui/screen/profiler.hpp.
+  friend class ProfiledNode;
 };
 
 void Render(Screen& screen, const Element& node);
 void Render(Screen& screen, Node* node);
 
+// Same as Render, skipping step 1. ComputeRequirement() must have been called
+// on the element already.
+void RenderMeasured(Screen& screen, const Element& element);
+void RenderMeasured(Screen& screen, Node* node);
+
+// Draw |element| at |width| columns and at the height it requires, and print
+// it into |out|, as Screen::ToString() would. The element is laid out once,
+// then drawn and printed |band_height| lines at a time: only those are held in
+// memory, however tall the element is.
+void RenderStreaming(std::ostream& out,
+                     const Element& element,
+                     int width,
+                     int band_height = 64);
+
+// Draw the large children of hbox, vbox and gridbox using |threads| additional
+// threads. Zero, the default, draws everything on the calling thread.
+void SetRenderThreads(int threads);
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_DOM_NODE_HPP */
@@ -0,0 +1,56 @@
+#ifndef FTXUI_DOM_OFFSCREEN_HPP
+#define FTXUI_DOM_OFFSCREEN_HPP
+
+#include <stddef.h>    // for size_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+
+#include "ftxui/dom/elements.hpp"  // for Element
+
+namespace ftxui {
+
+class OffscreenNode;
+
+/// @brief Draw an element into a private screen once, and copy it on the next
+/// frames, as long as its version and its size don't change.
+/// @ingroup dom
+///
+/// This is meant for the expensive elements, like large charts, changing less
+/// often than the rest of the interface. Their layout and their drawing are
+/// skipped: a frame costs a copy of their cells.
+///
+/// The element is drawn over blank cells, not over what is below it. It is
+/// drawn entirely, even the parts hidden by a frame, so that scrolling costs a
+/// copy too.
+///
+/// ### Example
+///
+/// ```cpp
+/// Offscreen chart_cache;
+///
+/// Element RenderChart() {
+///   return chart_cache.Render(chart.version, [&] { return chart.Render(); });
+/// }
+/// ```
+class Offscreen {
+ public:
+  Offscreen();
+  ~Offscreen();
+
+  // Return an element displaying what |build| returns. |build| is called the
+  // first time, and every time |version| changes. The element must depend only
+  // on what |version| describes. It must be used at most once per frame.
+  Element Render(size_t version, std::function<Element()> build);
+
+ private:
+  std::shared_ptr<OffscreenNode> node_;
+  size_t version_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_OFFSCREEN_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,63 @@
+#ifndef FTXUI_DOM_RECONCILER_HPP
+#define FTXUI_DOM_RECONCILER_HPP
+
+#include <functional>     // for function
+#include <memory>         // for shared_ptr
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+
+#include "ftxui/dom/elements.hpp"  // for Element
+
+namespace ftxui {
+
+class KeyedNode;
+
+/// @brief Keep the elements of the previous frames, identified by a key.
+/// @ingroup dom
+///
+/// An element requested with the same key and version as before is reused
+/// instead of being built again. It also keeps its requirement, its box and
+/// the cells it drew, so that drawing it again at the same place costs a copy.
+///
+/// ### Example
+///
+/// ```cpp
+/// Reconciler reconciler;
+///
+/// Element RenderItem(int i) {
+///   return reconciler.Keyed(std::to_string(i), items[i].version,
+///                           [&] { return text(items[i].name) | border; });
+/// }
+/// ```
+class Reconciler {
+ public:
+  Reconciler();
+  ~Reconciler();
+
+  // Return the element registered as |key|. It is built using |build| the
+  // first time, and every time |version| changes. The element must depend
+  // only on what |version| describes. A key must be used at most once per
+  // frame.
+  Element Keyed(const std::string& key,
+                size_t version,
+                std::function<Element()> build);
+
+  // Forget the elements not requested since the previous call.
+  void Sweep();
+
+ private:
+  struct Entry {
+    std::shared_ptr<KeyedNode> node;
+    size_t version = 0;
+    bool used = false;
+  };
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_RECONCILER_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,64 @@
+#ifndef FTXUI_DOM_SAMPLE_BUFFER_HPP
+#define FTXUI_DOM_SAMPLE_BUFFER_HPP
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint64_t
+#include <atomic>    // for atomic
+#include <memory>    // for unique_ptr
+#include <vector>    // for vector
+
+namespace ftxui {
+
+/// @brief The last samples of a series, in a ring of a fixed capacity. They
+/// are displayed by sparkline() and streaming_graph().
+/// @ingroup dom
+///
+/// One thread pushes the samples, and any other one reads them, without any
+/// lock. The producer never waits: when the ring is full, the oldest samples
+/// are overwritten.
+///
+/// ### Example
+///
+/// ```cpp
+/// auto cpu = std::make_shared<SampleBuffer>(256);
+/// std::thread probe([&] {
+///   for (;;) {
+///     cpu->Push(ReadCpuUsage());
+///     screen.PostEvent(Event::Custom);  // Draw the new sample.
+///     std::this_thread::sleep_for(100ms);
+///   }
+/// });
+///
+/// Element status = hbox({text(L"cpu "), sparkline(cpu)});
+/// ```
+class SampleBuffer {
+ public:
+  explicit SampleBuffer(size_t capacity);
+
+  // Add a sample. Only one thread at a time can push.
+  void Push(float sample);
+
+  // Copy the |count| last samples at most into |out|, from the oldest. The
+  // samples overwritten by a push while being copied are dropped, so |out| is
+  // always a consistent run of consecutive samples.
+  void Snapshot(size_t count, std::vector<float>* out) const;
+
+  size_t capacity() const { return capacity_; }
+
+  // The number of samples pushed since the creation.
+  uint64_t pushed() const { return pushed_.load(std::memory_order_acquire); }
+
+ private:
+  size_t capacity_;
+  std::unique_ptr<std::atomic<float>[]> samples_;
+  std::atomic<uint64_t> writing_{0};  // Incremented before writing a sample.
+  std::atomic<uint64_t> pushed_{0};   // Incremented after.
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_SAMPLE_BUFFER_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,38 @@
+#ifndef FTXUI_DOM_STRUCTURAL_HASH_HPP
+#define FTXUI_DOM_STRUCTURAL_HASH_HPP
+
+#include <stdint.h>  // for uint64_t
+#include <string>    // for wstring
+
+namespace ftxui {
+
+class Color;
+struct Pixel;
+
+/// @brief A hash of a document: its structure and what it displays, built by
+/// Node::Hash(). Two documents with the same hash are drawn the same way.
+/// @ingroup dom
+///
+/// It is used to skip drawing the frames identical to the previous one.
+class StructuralHash {
+ public:
+  void Add(uint64_t value);
+  void Add(const std::wstring& text);
+  void Add(const Color& color);
+  void Add(const Pixel& pixel);
+  void AddFloat(float value);
+  void AddPointer(const void* pointer);
+
+  uint64_t value() const { return value_; }
+
+ private:
+  uint64_t value_ = 0;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_STRUCTURAL_HASH_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
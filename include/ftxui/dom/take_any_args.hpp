@@ -1,4 +1,5 @@
 // IWYU pragma: private, include "ftxui/dom/elements.hpp"
+#include <stddef.h>  // for size_t
 #include <type_traits>
 
 namespace ftxui {
@@ -17,10 +18,26 @@ inline void Merge(Elements& container, Elements elements) {
     container.push_back(std::move(element));
 }
 
+template <class T>
+size_t Count(const T&) {
+  return 0;
+}
+
+template <>
+inline size_t Count(const Element&) {
+  return 1;
+}
+
+template <>
+inline size_t Count(const Elements& elements) {
+  return elements.size();
+}
+
 // Turn a set of arguments into a vector.
 template <class... Args>
 Elements unpack(Args... args) {
   std::vector<Element> vec;
+  vec.reserve((Count(args) + ... + 0));
   (Merge(vec, std::move(args)), ...);
   return vec;
 }
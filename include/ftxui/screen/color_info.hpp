@@ -21,6 +21,11 @@ struct ColorInfo {
 ColorInfo GetColorInfo(Color::Palette256 index);
 ColorInfo GetColorInfo(Color::Palette16 index);
 
+// The closest color of the palette 256, used when the terminal doesn't support
+// the true colors.
+Color::Palette256 ClosestPalette256(uint8_t red, uint8_t green, uint8_t blue);
+void SetPerceptualQuantization(bool enabled);
+
 }  // namespace ftxui
 
 #endif /* end of include guard: FTXUI_SCREEN_COLOR_INFO_HPP */
@@ -0,0 +1,53 @@
+#ifndef FTXUI_SCREEN_COLOR_MAP_HPP
+#define FTXUI_SCREEN_COLOR_MAP_HPP
+
+#include <array>       // for array
+#include <functional>  // for function
+
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+/// @brief The colors of the values in [0, 1], sampled once into a table of
+/// 256 colors. Used by heatmap().
+/// @ingroup screen
+///
+/// The colors are converted to what the terminal supports when the table is
+/// built, so looking a value up costs an index. Keep it around, to build it
+/// only once.
+///
+/// ### Example
+///
+/// ```cpp
+/// ColorMap heat([](float value) {
+///   return Color::RGB(255 * value, 0, 255 * (1 - value));
+/// });
+/// ```
+class ColorMap {
+ public:
+  static constexpr int kSize = 256;
+
+  explicit ColorMap(const std::function<Color(float value)>& color);
+
+  // The color of |value|, clamped to [0, 1]. NaN is Color::Default.
+  const Color& operator()(float value) const {
+    if (!(value == value))
+      return default_;
+    value = value < 0.f ? 0.f : value > 1.f ? 1.f : value;
+    return colors_[int(value * (kSize - 1) + 0.5f)];
+  }
+
+  const std::array<Color, kSize>& colors() const { return colors_; }
+
+ private:
+  std::array<Color, kSize> colors_;
+  Color default_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_SCREEN_COLOR_MAP_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,53 @@
+#ifndef FTXUI_SCREEN_INTERNED_STRING_HPP
+#define FTXUI_SCREEN_INTERNED_STRING_HPP
+
+#include <memory>  // for shared_ptr
+#include <string>  // for wstring
+
+namespace ftxui {
+
+/// @brief An immutable string. The strings with the same content share a
+/// single copy, measured once.
+/// @ingroup screen
+///
+/// Copying it costs a reference count. Creating it costs a lookup in a pool,
+/// so prefer keeping the repeated ones around, e.g. the labels of a table.
+///
+/// ### Example
+///
+/// ```cpp
+/// InternedString ok = std::wstring(L"OK");
+/// Element cell = text(ok);
+/// ```
+class InternedString {
+ public:
+  InternedString();
+  InternedString(const std::wstring& text);
+
+  const std::wstring& str() const { return data_->text; }
+  int width() const { return data_->width; }
+
+  // The strings with the same content are the same object.
+  bool operator==(const InternedString& other) const {
+    return data_ == other.data_;
+  }
+  bool operator!=(const InternedString& other) const {
+    return data_ != other.data_;
+  }
+
+  struct Data {
+    std::wstring text;
+    int width;
+  };
+
+ private:
+  std::shared_ptr<const Data> data_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_SCREEN_INTERNED_STRING_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
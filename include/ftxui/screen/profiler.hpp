@@ -0,0 +1,85 @@
+#ifndef FTXUI_SCREEN_PROFILER_HPP
+#define FTXUI_SCREEN_PROFILER_HPP
+
+#include <array>     // for array
+#include <chrono>    // for nanoseconds, steady_clock
+#include <map>       // for map
+#include <string>    // for string
+#include <typeinfo>  // for type_info
+
+namespace ftxui {
+
+/// @brief Measure the time spent drawing frames.
+/// @ingroup screen
+///
+/// The measures are taken only when FTXUI is built with the CMake option
+/// FTXUI_ENABLE_PROFILING. Otherwise, the report stays empty and drawing
+/// costs nothing more.
+///
+/// ### Example
+///
+/// ```cpp
+/// profiler::Reset();
+/// Render(screen, document);
+/// std::cout << screen.ToString() << std::endl;
+/// std::cout << profiler::GetReport().ToString() << std::endl;
+/// ```
+namespace profiler {
+
+enum class Phase {
+  ComputeRequirement,
+  SetBox,
+  Render,
+  ApplyShader,
+  ToString,
+};
+const int kPhaseCount = 5;
+
+struct Timing {
+  int calls = 0;
+  std::chrono::nanoseconds time = std::chrono::nanoseconds(0);
+};
+
+struct Report {
+  // The time spent in each phase, indexed by Phase.
+  std::array<Timing, kPhaseCount> phases;
+
+  // The time spent in the nodes of every type, excluding their children,
+  // indexed by Phase.
+  std::map<std::string, std::array<Timing, kPhaseCount>> nodes;
+
+  std::string ToString() const;
+};
+
+// Whether FTXUI was built with FTXUI_ENABLE_PROFILING.
+bool Enabled();
+
+Report GetReport();
+void Reset();
+
+// Measure the time until its destruction. Used by FTXUI to measure a |phase|,
+// or the calls to a node of type |type| during |phase|.
+class Scope {
+ public:
+  Scope(Phase phase, const std::type_info* type = nullptr);
+  ~Scope();
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  Phase phase_;
+  const std::type_info* type_;
+  std::chrono::steady_clock::time_point start_;
+  std::chrono::nanoseconds children_time_ = std::chrono::nanoseconds(0);
+  Scope* parent_;
+};
+
+}  // namespace profiler
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_SCREEN_PROFILER_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
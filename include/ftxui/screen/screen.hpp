@@ -40,6 +40,9 @@ struct Pixel {
         dim(false),
         inverted(false),
         underlined(false) {}
+
+  bool operator==(const Pixel& other) const;
+  bool operator!=(const Pixel& other) const;
 };
 
 /// @brief Define how the Screen's dimensions should look like.
@@ -93,10 +96,45 @@ class Screen {
   void SetCursor(Cursor cursor) { cursor_ = cursor; }
 
  protected:
+  friend class RowWriter;
+
   int dimx_;
   int dimy_;
   std::vector<std::vector<Pixel>> pixels_;
   Cursor cursor_;
+
+  // Coordinates of pixels_[0][0]. Non zero for screens holding only a part of
+  // what the nodes draw. The stencil is expressed in the same coordinates as
+  // the nodes.
+  int origin_x_ = 0;
+  int origin_y_ = 0;
+};
+
+/// @brief The pixels of a row of a Screen, between two columns, clipped once by
+/// its stencil. They are accessed without any further check.
+/// @ingroup screen
+///
+/// This is meant for the nodes drawing runs of cells. Screen::PixelAt() checks
+/// the stencil at every call.
+class RowWriter {
+ public:
+  // The pixels of the row |y|, from |x_min| to |x_max|.
+  RowWriter(Screen& screen, int y, int x_min, int x_max);
+
+  // The columns that can be written. None when x_min() > x_max().
+  int x_min() const { return x_min_; }
+  int x_max() const { return x_max_; }
+  bool Contain(int x) const { return x_min_ <= x && x <= x_max_; }
+
+  // Same as Screen::PixelAt() and Screen::at(). |x| must be contained.
+  Pixel& PixelAt(int x) { return row_[x - origin_x_]; }
+  wchar_t& at(int x) { return row_[x - origin_x_].character[0]; }
+
+ private:
+  Pixel* row_ = nullptr;
+  int origin_x_ = 0;
+  int x_min_ = 0;
+  int x_max_ = -1;
 };
 
 }  // namespace ftxui
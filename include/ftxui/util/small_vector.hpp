@@ -0,0 +1,179 @@
+#ifndef FTXUI_UTIL_SMALL_VECTOR_HPP
+#define FTXUI_UTIL_SMALL_VECTOR_HPP
+
+#include <stddef.h>          // for size_t
+#include <algorithm>         // for max, move, rotate
+#include <array>             // for array
+#include <initializer_list>  // for initializer_list
+#include <stdexcept>         // for out_of_range
+#include <type_traits>       // for is_nothrow_move_assignable
+#include <utility>           // for move, forward
+#include <vector>            // for vector
+
+namespace ftxui {
+
+/// A vector storing up to |N| elements inline, without allocating memory.
+/// Beyond, the elements are moved into a std::vector.
+///
+/// T must be default constructible and movable. The unused inline elements are
+/// kept default constructed.
+///
+/// It has the subset of the std::vector API used by the nodes. Unlike a
+/// std::vector, moving it moves the inline elements one by one: the pointers to
+/// them are invalidated. The vector moved from is left empty.
+template <typename T, size_t N>
+class SmallVector {
+ public:
+  SmallVector() = default;
+  SmallVector(std::initializer_list<T> elements) {
+    reserve(elements.size());
+    for (auto& element : elements)
+      push_back(element);
+  }
+
+  // Take the elements of |elements|. When they don't fit inline, its storage
+  // is reused as is.
+  SmallVector(std::vector<T> elements) {
+    if (elements.size() > N) {
+      heap_ = std::move(elements);
+      use_heap_ = true;
+      return;
+    }
+    for (auto& element : elements)
+      inline_[inline_size_++] = std::move(element);
+  }
+
+  SmallVector(const SmallVector&) = default;
+  SmallVector& operator=(const SmallVector&) = default;
+  SmallVector(SmallVector&& other) noexcept(kNothrowMove) {
+    *this = std::move(other);
+  }
+  SmallVector& operator=(SmallVector&& other) noexcept(kNothrowMove) {
+    if (this == &other)
+      return *this;
+    inline_ = std::move(other.inline_);
+    inline_size_ = other.inline_size_;
+    heap_ = std::move(other.heap_);
+    use_heap_ = other.use_heap_;
+    other.clear();
+    return *this;
+  }
+
+  T* begin() { return data(); }
+  T* end() { return data() + size(); }
+  const T* begin() const { return data(); }
+  const T* end() const { return data() + size(); }
+
+  T* data() { return use_heap_ ? heap_.data() : inline_.data(); }
+  const T* data() const { return use_heap_ ? heap_.data() : inline_.data(); }
+  size_t size() const { return use_heap_ ? heap_.size() : inline_size_; }
+  bool empty() const { return size() == 0; }
+
+  T& operator[](size_t i) { return data()[i]; }
+  const T& operator[](size_t i) const { return data()[i]; }
+  T& at(size_t i) {
+    if (i >= size())
+      throw std::out_of_range("SmallVector::at");
+    return data()[i];
+  }
+  const T& at(size_t i) const {
+    return const_cast<SmallVector*>(this)->at(i);
+  }
+  T& front() { return data()[0]; }
+  T& back() { return data()[size() - 1]; }
+  const T& front() const { return data()[0]; }
+  const T& back() const { return data()[size() - 1]; }
+
+  void push_back(T element) {
+    if (!use_heap_ && inline_size_ < N) {
+      inline_[inline_size_++] = std::move(element);
+      return;
+    }
+    if (!use_heap_)
+      MoveToHeap(2 * N);
+    heap_.push_back(std::move(element));
+  }
+
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    push_back(T(std::forward<Args>(args)...));
+    return back();
+  }
+
+  // Insert |element| before |position|. Return where it is.
+  T* insert(const T* position, T element) {
+    const size_t index = position - begin();
+    push_back(std::move(element));
+    std::rotate(begin() + index, end() - 1, end());
+    return begin() + index;
+  }
+
+  // Remove the elements in [first, last). Return what follows them.
+  T* erase(const T* first, const T* last) {
+    const size_t index = first - begin();
+    const size_t count = last - first;
+    if (use_heap_) {
+      heap_.erase(heap_.begin() + index, heap_.begin() + index + count);
+      return begin() + index;
+    }
+    std::move(begin() + index + count, end(), begin() + index);
+    for (size_t i = inline_size_ - count; i < inline_size_; ++i)
+      inline_[i] = T();
+    inline_size_ -= count;
+    return begin() + index;
+  }
+  T* erase(const T* position) { return erase(position, position + 1); }
+
+  void resize(size_t size) {
+    if (size < this->size()) {
+      erase(begin() + size, end());
+      return;
+    }
+    reserve(size);
+    while (this->size() < size)
+      push_back(T());
+  }
+
+  void reserve(size_t capacity) {
+    if (use_heap_)
+      heap_.reserve(capacity);
+    else if (capacity > N)
+      MoveToHeap(capacity);
+  }
+
+  void clear() {
+    for (size_t i = 0; i < inline_size_; ++i)
+      inline_[i] = T();
+    inline_size_ = 0;
+    heap_.clear();
+    use_heap_ = false;
+  }
+
+ private:
+  void MoveToHeap(size_t capacity) {
+    heap_.reserve(std::max(capacity, inline_size_));
+    for (size_t i = 0; i < inline_size_; ++i) {
+      heap_.push_back(std::move(inline_[i]));
+      inline_[i] = T();
+    }
+    inline_size_ = 0;
+    use_heap_ = true;
+  }
+
+  static constexpr bool kNothrowMove =
+      std::is_nothrow_move_assignable<T>::value &&
+      std::is_nothrow_default_constructible<T>::value;
+
+  std::array<T, N> inline_;
+  size_t inline_size_ = 0;
+  std::vector<T> heap_;
+  bool use_heap_ = false;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_UTIL_SMALL_VECTOR_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
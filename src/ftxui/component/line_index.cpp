@@ -0,0 +1,134 @@
+#include <algorithm>  // for min, upper_bound
+#include <chrono>  // for steady_clock, milliseconds, operator-, operator>=
+#include <cstring>  // for memchr
+#include <utility>  // for move
+
+#include "ftxui/component/line_index.hpp"
+
+namespace ftxui {
+
+namespace {
+
+// The text is indexed by chunks. The progress is published after each one.
+const size_t kChunkSize = 1 << 20;
+
+// The minimal delay in between two calls to |on_progress|.
+const auto kProgressDelay = std::chrono::milliseconds(100);
+
+}  // namespace
+
+LineIndex::LineIndex(const char* data,
+                     size_t size,
+                     std::function<void()> on_progress)
+    : data_(data),
+      size_(size),
+      lines_(size ? 1 : 0),
+      scanned_(0),
+      done_(false),
+      stop_(false) {
+  checkpoints_.push_back(0);
+  thread_ = std::thread(&LineIndex::Run, this, std::move(on_progress));
+}
+
+LineIndex::~LineIndex() {
+  stop_ = true;
+  thread_.join();
+}
+
+void LineIndex::Run(std::function<void()> on_progress) {
+  int lines = lines_;
+  size_t offset = 0;
+  auto last_progress = std::chrono::steady_clock::now();
+  std::vector<size_t> checkpoints;
+
+  while (offset < size_ && !stop_) {
+    const size_t end = std::min(offset + kChunkSize, size_);
+    while (offset < end) {
+      auto* newline =
+          static_cast<const char*>(memchr(data_ + offset, '\n', end - offset));
+      if (!newline) {
+        offset = end;
+        break;
+      }
+      offset = newline - data_ + 1;
+      // A newline ending the text doesn't start a new line.
+      if (offset == size_)
+        break;
+      if (lines % kStride == 0)
+        checkpoints.push_back(offset);
+      lines++;
+    }
+
+    // The checkpoints must be visible before the lines they index.
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      checkpoints_.insert(checkpoints_.end(), checkpoints.begin(),
+                          checkpoints.end());
+    }
+    checkpoints.clear();
+    lines_ = lines;
+    scanned_ = offset;
+
+    auto now = std::chrono::steady_clock::now();
+    if (now - last_progress >= kProgressDelay) {
+      last_progress = now;
+      on_progress();
+    }
+  }
+
+  done_ = true;
+  if (!stop_)
+    on_progress();
+}
+
+size_t LineIndex::Checkpoint(int index) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return checkpoints_[index];
+}
+
+bool LineIndex::Find(int line, size_t* offset) const {
+  if (line < 0 || line >= lines_)
+    return false;
+
+  size_t out = Checkpoint(line / kStride);
+  for (int i = line % kStride; i; --i) {
+    auto* newline =
+        static_cast<const char*>(memchr(data_ + out, '\n', size_ - out));
+    out = newline - data_ + 1;
+  }
+  *offset = out;
+  return true;
+}
+
+int LineIndex::LineOf(size_t offset) const {
+  if (offset >= scanned_ && !done_)
+    return -1;
+  offset = std::min(offset, size_);
+
+  int index;
+  size_t start;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it =
+        std::upper_bound(checkpoints_.begin(), checkpoints_.end(), offset);
+    index = int(it - checkpoints_.begin()) - 1;
+    start = checkpoints_[index];
+  }
+
+  int line = index * kStride;
+  while (start < offset) {
+    auto* newline =
+        static_cast<const char*>(memchr(data_ + start, '\n', offset - start));
+    if (!newline)
+      break;
+    start = newline - data_ + 1;
+    line++;
+  }
+  return std::min(line, std::max(int(lines_) - 1, 0));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,70 @@
+#ifndef FTXUI_COMPONENT_LINE_INDEX_HPP
+#define FTXUI_COMPONENT_LINE_INDEX_HPP
+
+#include <stddef.h>    // for size_t
+#include <atomic>      // for atomic
+#include <functional>  // for function
+#include <mutex>       // for mutex
+#include <thread>      // for thread
+#include <vector>      // for vector
+
+namespace ftxui {
+
+// The offsets of the lines of a text, found by a background thread. The index
+// can be queried while it is still being built: the lines not reached yet are
+// reported as unknown.
+//
+// Only one offset every |kStride| lines is stored. The others are found again
+// by scanning forward from the closest one.
+class LineIndex {
+ public:
+  // |data| must outlive the index. |on_progress| is called from the indexing
+  // thread, every time a significant part of the text has been indexed.
+  LineIndex(const char* data,
+            size_t size,
+            std::function<void()> on_progress = [] {});
+  ~LineIndex();
+
+  LineIndex(const LineIndex&) = delete;
+  LineIndex& operator=(const LineIndex&) = delete;
+
+  // The number of lines indexed so far. Final once done().
+  int lines() const { return lines_; }
+  // The number of bytes indexed so far.
+  size_t scanned() const { return scanned_; }
+  bool done() const { return done_; }
+
+  // Store into |offset| the offset of the first byte of |line|. Return false
+  // when |line| hasn't been indexed yet, or doesn't exist.
+  bool Find(int line, size_t* offset) const;
+
+  // The line containing the byte at |offset|, or -1 when it hasn't been
+  // indexed yet.
+  int LineOf(size_t offset) const;
+
+  static const int kStride = 64;
+
+ private:
+  void Run(std::function<void()> on_progress);
+  size_t Checkpoint(int index) const;
+
+  const char* data_;
+  size_t size_;
+
+  mutable std::mutex mutex_;
+  std::vector<size_t> checkpoints_;  // The offset of lines 0, kStride, ...
+
+  std::atomic<int> lines_;
+  std::atomic<size_t> scanned_;
+  std::atomic<bool> done_;
+  std::atomic<bool> stop_;
+  std::thread thread_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_LINE_INDEX_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,80 @@
+#include <gtest/gtest-message.h>  // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult, SuiteApiResolver, TestFactoryImpl
+#include <stddef.h>                 // for size_t
+#include <string>                   // for string, allocator
+#include <thread>                   // for yield
+
+#include "ftxui/component/line_index.hpp"  // for LineIndex
+#include "gtest/gtest_pred_impl.h"  // for AssertionResult, EXPECT_EQ, Test, EXPECT_TRUE, EXPECT_FALSE, TEST
+
+using namespace ftxui;
+
+namespace {
+void Wait(const LineIndex& index) {
+  while (!index.done())
+    std::this_thread::yield();
+}
+}  // namespace
+
+TEST(LineIndexTest, Empty) {
+  LineIndex index(nullptr, 0);
+  Wait(index);
+  size_t offset;
+  EXPECT_EQ(index.lines(), 0);
+  EXPECT_FALSE(index.Find(0, &offset));
+}
+
+TEST(LineIndexTest, Lines) {
+  std::string text = "a\n\nbc\nd";
+  LineIndex index(text.data(), text.size());
+  Wait(index);
+  EXPECT_EQ(index.lines(), 4);
+
+  size_t offset;
+  EXPECT_TRUE(index.Find(0, &offset));
+  EXPECT_EQ(offset, 0u);
+  EXPECT_TRUE(index.Find(1, &offset));
+  EXPECT_EQ(offset, 2u);
+  EXPECT_TRUE(index.Find(2, &offset));
+  EXPECT_EQ(offset, 3u);
+  EXPECT_TRUE(index.Find(3, &offset));
+  EXPECT_EQ(offset, 6u);
+  EXPECT_FALSE(index.Find(4, &offset));
+
+  EXPECT_EQ(index.LineOf(0), 0);
+  EXPECT_EQ(index.LineOf(1), 0);
+  EXPECT_EQ(index.LineOf(2), 1);
+  EXPECT_EQ(index.LineOf(4), 2);
+  EXPECT_EQ(index.LineOf(6), 3);
+}
+
+TEST(LineIndexTest, TrailingNewline) {
+  std::string text = "a\nb\n";
+  LineIndex index(text.data(), text.size());
+  Wait(index);
+  EXPECT_EQ(index.lines(), 2);
+  EXPECT_EQ(index.LineOf(3), 1);
+  EXPECT_EQ(index.LineOf(4), 1);
+}
+
+TEST(LineIndexTest, Checkpoints) {
+  std::string text;
+  for (int i = 0; i < 10 * LineIndex::kStride; ++i)
+    text += std::to_string(i) + "\n";
+  LineIndex index(text.data(), text.size());
+  Wait(index);
+  EXPECT_EQ(index.lines(), 10 * LineIndex::kStride);
+
+  for (int line : {63, 64, 65, 200, 639}) {
+    size_t offset;
+    EXPECT_TRUE(index.Find(line, &offset));
+    EXPECT_EQ(text.substr(offset, text.find('\n', offset) - offset),
+              std::to_string(line));
+    EXPECT_EQ(index.LineOf(offset), line);
+    EXPECT_EQ(index.LineOf(offset + 1), line);
+  }
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
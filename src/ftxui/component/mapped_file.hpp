@@ -0,0 +1,40 @@
+#ifndef FTXUI_COMPONENT_MAPPED_FILE_HPP
+#define FTXUI_COMPONENT_MAPPED_FILE_HPP
+
+#include <stddef.h>  // for size_t
+#include <string>    // for string
+
+namespace ftxui {
+
+// A read only file, mapped into memory. Its pages are read by the system on
+// demand, so that opening a large file is immediate.
+class MappedFile {
+ public:
+  MappedFile(const std::string& path);
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  // Whether the file could be opened. An empty file is valid, with no data.
+  bool valid() const { return valid_; }
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  bool valid_ = false;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+#if defined(_WIN32)
+  void* file_ = nullptr;
+  void* mapping_ = nullptr;
+#endif
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_MAPPED_FILE_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
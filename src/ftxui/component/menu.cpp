@@ -15,15 +15,33 @@
 #include "ftxui/component/screen_interactive.hpp"  // for Component
 #include "ftxui/dom/elements.hpp"  // for operator|, Element, reflect, text, vbox, Elements, focus, nothing, select
 #include "ftxui/screen/box.hpp"  // for Box
+#include "ftxui/screen/interned_string.hpp"  // for InternedString
 #include "ftxui/util/ref.hpp"    // for Ref
 
 namespace ftxui {
 
+namespace {
+
+Element Label(bool is_selected, const std::wstring& entry) {
+  return text((is_selected ? L"> " : L"  ") + entry);
+}
+
+// The icon is drawn by the same element, so that the interned entry isn't
+// copied.
+Element Label(bool is_selected, const InternedString& entry) {
+  static const InternedString selected_icon = std::wstring(L"> ");
+  static const InternedString unselected_icon = std::wstring(L"  ");
+  return text(is_selected ? selected_icon : unselected_icon, entry);
+}
+
+}  // namespace
+
 /// @brief A list of items. The user can navigate through them.
 /// @ingroup component
+template <typename Entry>  // Entry = {std::wstring, InternedString}
 class MenuBase : public ComponentBase {
  public:
-  MenuBase(const std::vector<std::wstring>* entries,
+  MenuBase(const std::vector<Entry>* entries,
            int* selected,
            Ref<MenuOption> option)
       : entries_(entries), selected_(selected), option_(option) {}
@@ -43,8 +61,7 @@ class MenuBase : public ComponentBase {
       auto focus_management = !is_selected      ? nothing
                               : is_menu_focused ? focus
                                                 : select;
-      auto icon = is_selected ? L"> " : L"  ";
-      elements.push_back(text(icon + entries_->at(i)) | style |
+      elements.push_back(Label(is_selected, entries_->at(i)) | style |
                          focus_management | reflect(boxes_[i]));
     }
     return vbox(std::move(elements));
@@ -109,7 +126,7 @@ class MenuBase : public ComponentBase {
   int& focused_entry() { return option_->focused_entry(); }
 
  protected:
-  const std::vector<std::wstring>* const entries_;
+  const std::vector<Entry>* const entries_;
   int* selected_ = 0;
   Ref<MenuOption> option_;
 
@@ -147,7 +164,19 @@ class MenuBase : public ComponentBase {
 Component Menu(const std::vector<std::wstring>* entries,
                int* selected,
                Ref<MenuOption> option) {
-  return Make<MenuBase>(entries, selected, std::move(option));
+  return Make<MenuBase<std::wstring>>(entries, selected, std::move(option));
+}
+
+/// @brief A list of interned text. The focused element is selected.
+/// @param entries The list of entries in the menu.
+/// @param selected The index of the currently selected element.
+/// @param option Additional optional parameters.
+/// @ingroup component
+/// @see InternedString
+Component Menu(const std::vector<InternedString>* entries,
+               int* selected,
+               Ref<MenuOption> option) {
+  return Make<MenuBase<InternedString>>(entries, selected, std::move(option));
 }
 
 }  // namespace ftxui
@@ -0,0 +1,736 @@
+#include <limits.h>            // for INT_MAX
+#include <stddef.h>            // for size_t
+#include <algorithm>           // for max, min, lower_bound
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstring>             // for memchr, memcmp
+#include <functional>          // for function
+#include <memory>              // for shared_ptr, make_shared
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <string>              // for string, wstring
+#include <thread>              // for thread
+#include <utility>             // for move, swap
+#include <vector>              // for vector
+
+#include "ftxui/component/captured_mouse.hpp"     // for CapturedMouse
+#include "ftxui/component/component.hpp"          // for Make, Pager
+#include "ftxui/component/component_base.hpp"     // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for PagerOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::ArrowLeft, Event::ArrowRight, Event::PageDown, Event::PageUp, Event::Home, Event::End, Event::Return, Event::Escape, Event::Backspace
+#include "ftxui/component/line_index.hpp"   // for LineIndex
+#include "ftxui/component/mapped_file.hpp"  // for MappedFile
+#include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::WheelDown, Mouse::WheelUp
+#include "ftxui/component/trigram_index.hpp"  // for TrigramIndex
+#include "ftxui/dom/elements.hpp"  // for Element, text, hbox, vbox, filler, inverted, flex, reflect
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Pixel, Screen, RowWriter
+#include "ftxui/screen/string.hpp"    // for to_string, to_wstring, wchar_width
+#include "ftxui/util/ref.hpp"         // for Ref
+
+namespace ftxui {
+
+namespace {
+
+const int kTabWidth = 8;
+const int kWheelLines = 3;
+
+// The first column displayed can't be further. This is way past the lines
+// anyone reads, and far from overflowing.
+const int kMaxLeft = 1 << 20;
+
+// Beyond this number of matches, the next ones aren't listed.
+const size_t kMaxMatches = 1 << 20;
+
+// Decode the UTF-8 character at the beginning of |data|, and return its size.
+// An invalid byte is decoded alone, as the replacement character.
+size_t DecodeUTF8(const unsigned char* data, size_t size, char32_t* out) {
+  const unsigned char c = data[0];
+  size_t length = c < 0x80 ? 1 : c < 0xC2 ? 0 : c < 0xE0 ? 2 : c < 0xF0 ? 3
+                           : c < 0xF5     ? 4
+                                          : 0;
+  if (length == 1) {
+    *out = c;
+    return 1;
+  }
+  if (length == 0 || length > size) {
+    *out = 0xFFFD;
+    return 1;
+  }
+
+  char32_t code = c & (0x7F >> length);
+  for (size_t i = 1; i < length; ++i) {
+    if ((data[i] & 0xC0) != 0x80) {
+      *out = 0xFFFD;
+      return 1;
+    }
+    code = (code << 6) | (data[i] & 0x3F);
+  }
+
+  // Reject the overlong encodings and the surrogates.
+  const char32_t minimum[] = {0, 0, 0x80, 0x800, 0x10000};
+  if (code < minimum[length] || code > 0x10FFFF ||
+      (code >= 0xD800 && code <= 0xDFFF)) {
+    *out = 0xFFFD;
+    return 1;
+  }
+  *out = code;
+  return length;
+}
+
+// Search the trigram index on a thread of its own, so that the UI doesn't wait
+// for a search through a large file. Starting a search cancels the previous
+// one.
+class Searcher {
+ public:
+  Searcher(const TrigramIndex& trigrams, std::function<void()> on_done)
+      : trigrams_(trigrams),
+        on_done_(std::move(on_done)),
+        thread_([this] { Run(); }) {}
+
+  ~Searcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+      cancel_ = true;
+    }
+    wake_.notify_one();
+    thread_.join();
+  }
+
+  void Start(const std::string& query) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      query_ = query;
+      pending_ = true;
+      done_ = false;
+      cancel_ = true;
+    }
+    wake_.notify_one();
+  }
+
+  void Cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_ = false;
+    done_ = false;
+    cancel_ = true;
+  }
+
+  // Move the matches of the last search started to |matches|. Return false
+  // when they aren't found yet.
+  bool Take(std::vector<size_t>* matches, bool* all_matches) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!done_)
+      return false;
+    done_ = false;
+    std::swap(*matches, matches_);
+    matches_.clear();
+    *all_matches = all_matches_;
+    return true;
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_.wait(lock, [this] { return quit_ || pending_; });
+      if (quit_)
+        return;
+      std::string query = std::move(query_);
+      pending_ = false;
+      cancel_ = false;
+
+      lock.unlock();
+      std::vector<size_t> matches;
+      bool all_matches = trigrams_.Find(query, kMaxMatches, &matches, &cancel_);
+      lock.lock();
+
+      // Another search started, or this one was cancelled.
+      if (cancel_)
+        continue;
+
+      matches_ = std::move(matches);
+      all_matches_ = all_matches;
+      done_ = true;
+      lock.unlock();
+      on_done_();
+      lock.lock();
+    }
+  }
+
+  const TrigramIndex& trigrams_;
+  std::function<void()> on_done_;
+
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::string query_;
+  bool pending_ = false;  // |query_| is to be searched.
+  bool done_ = false;     // |matches_| holds the last search's matches.
+  bool quit_ = false;
+  std::atomic<bool> cancel_{false};
+  std::vector<size_t> matches_;
+  bool all_matches_ = true;
+
+  std::thread thread_;
+};
+
+// The state shared in between the component and the element it renders.
+struct PagerState {
+  PagerState(const std::string& path,
+             std::function<void()> on_progress,
+             std::function<void()> on_search_done)
+      : file(path),
+        index(file.data(), file.size(), std::move(on_progress)),
+        trigrams(file.data(), file.size()),
+        searcher(trigrams, std::move(on_search_done)) {}
+
+  MappedFile file;
+  LineIndex index;
+  TrigramIndex trigrams;
+  Searcher searcher;
+
+  // The searched string, and the offsets of its occurrences. They are all
+  // listed, unless there are more than kMaxMatches. While |searching|, they
+  // aren't found yet.
+  std::string query;
+  std::vector<size_t> matches;
+  bool all_matches = true;
+  bool searching = false;
+
+  size_t top = 0;  // The offset of the first line displayed.
+  int left = 0;    // The first column displayed.
+  int height = 0;  // The number of lines displayed, in the last frame.
+
+  // A line to jump to, once it will be indexed. -1 when there are none.
+  int pending_line = -1;
+
+  size_t size() const { return file.size(); }
+
+  size_t LineStart(size_t offset) const {
+    const char* data = file.data();
+    while (offset > 0 && data[offset - 1] != '\n')
+      offset--;
+    return offset;
+  }
+
+  size_t NextLine(size_t offset) const {
+    auto* newline = static_cast<const char*>(
+        memchr(file.data() + offset, '\n', size() - offset));
+    return newline ? newline - file.data() + 1 : size();
+  }
+
+  size_t PreviousLine(size_t offset) const {
+    return offset ? LineStart(offset - 1) : 0;
+  }
+
+  // The first line of the last page.
+  size_t LastPage() const {
+    size_t end = size();
+    if (end && file.data()[end - 1] == '\n')
+      end--;
+    size_t offset = LineStart(end);
+    for (int i = 1; i < height; ++i)
+      offset = PreviousLine(offset);
+    return offset;
+  }
+
+  void MoveTo(size_t offset) { top = std::min(offset, LastPage()); }
+
+  // Scrolling stops at the last page, or at the first line, whatever the
+  // number of lines asked.
+  void MoveDown(int lines) {
+    const size_t last = LastPage();
+    size_t offset = top;
+    for (int i = 0; i < lines && offset < last; ++i)
+      offset = NextLine(offset);
+    MoveTo(offset);
+  }
+
+  void MoveUp(int lines) {
+    for (int i = 0; i < lines && top > 0; ++i)
+      top = PreviousLine(top);
+  }
+
+  // Jump to |line|. If it hasn't been indexed yet, the jump is done later.
+  void JumpTo(int line) {
+    line = std::max(line, 0);
+    pending_line = -1;
+    size_t offset;
+    if (index.Find(line, &offset))
+      MoveTo(offset);
+    else if (!index.done())
+      pending_line = line;
+    else
+      MoveTo(size());
+  }
+
+  // Jump to the line containing the byte at |percent| of the file. This doesn't
+  // require the file to be indexed.
+  void JumpToPercent(int percent) {
+    pending_line = -1;
+    percent = std::max(0, std::min(100, percent));
+    MoveTo(LineStart(size_t(double(size()) * percent / 100)));
+  }
+
+  // Search |text|. Its matches are filtered from the ones of a string it
+  // extends, otherwise they are searched by |searcher|, and TakeMatches()
+  // applies them.
+  void Search(const std::string& text) {
+    // The occurrences of the longer string are among the ones of the shorter.
+    const bool refine = !searching && all_matches && !query.empty() &&
+                        text.size() > query.size() &&
+                        text.compare(0, query.size(), query) == 0;
+    if (refine) {
+      const size_t length = query.size();
+      const size_t extra = text.size() - length;
+      size_t kept = 0;
+      for (size_t match : matches) {
+        if (match + text.size() <= size() &&
+            memcmp(file.data() + match + length, text.data() + length,
+                   extra) == 0) {
+          matches[kept++] = match;
+        }
+      }
+      matches.resize(kept);
+    } else {
+      matches.clear();
+      all_matches = true;
+      searching = !text.empty();
+      if (searching) {
+        // The index is built for the files which are searched only.
+        trigrams.Start();
+        searcher.Start(text);
+      } else {
+        searcher.Cancel();
+      }
+    }
+    query = text;
+  }
+
+  // Apply the matches found by |searcher|. Return false when there are none
+  // new.
+  bool TakeMatches() {
+    if (!searching || !searcher.Take(&matches, &all_matches))
+      return false;
+    searching = false;
+    return true;
+  }
+
+  // Jump to the first match from |offset|. Return false when there are none.
+  bool JumpToMatch(size_t offset) {
+    auto it = std::lower_bound(matches.begin(), matches.end(), offset);
+    if (it == matches.end())
+      return false;
+    MoveTo(LineStart(*it));
+    return true;
+  }
+
+  // Go to the |count|-th next line holding a match, stopping at the last one,
+  // or at the last page.
+  void NextMatch(int count) {
+    const size_t last = LastPage();
+    size_t offset = top;
+    for (; count > 0 && offset < last; --count) {
+      auto it = std::lower_bound(matches.begin(), matches.end(),
+                                 NextLine(offset));
+      if (it == matches.end())
+        break;
+      offset = LineStart(*it);
+    }
+    MoveTo(offset);
+  }
+
+  // Go to the |count|-th previous line holding a match, stopping at the first
+  // one.
+  void PreviousMatch(int count) {
+    size_t offset = top;
+    for (; count > 0; --count) {
+      auto it = std::lower_bound(matches.begin(), matches.end(), offset);
+      if (it == matches.begin())
+        break;
+      offset = LineStart(*--it);
+    }
+    MoveTo(offset);
+  }
+};
+
+// Draw the lines of the file directly, decoding only the visible characters.
+class PagerView : public Node {
+ public:
+  PagerView(std::shared_ptr<PagerState> state) : state_(std::move(state)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    state_->height = box.y_max - box.y_min + 1;
+  }
+
+  void Render(Screen& screen) override {
+    size_t offset = state_->top;
+    for (int y = box_.y_min; y <= box_.y_max && offset < state_->size(); ++y)
+      offset = RenderLine(screen, y, offset);
+  }
+
+ private:
+  // Draw the line starting at |offset| on the row |y|. Return the offset of the
+  // next line.
+  size_t RenderLine(Screen& screen, int y, size_t offset) {
+    auto* data = reinterpret_cast<const unsigned char*>(state_->file.data());
+    const size_t next = state_->NextLine(offset);
+    const int left = state_->left;
+    const int right = left + box_.x_max - box_.x_min + 1;
+    RowWriter row(screen, y, box_.x_min, box_.x_max);
+
+    // The first match which can cover the line. Only the matches of the
+    // visible lines are looked at.
+    const auto& matches = state_->matches;
+    const size_t length = state_->query.size();
+    auto match = std::lower_bound(matches.begin(), matches.end(),
+                                  offset >= length ? offset - length + 1 : 0);
+
+    int column = 0;
+    while (offset < next && column < right) {
+      while (match != matches.end() && *match + length <= offset)
+        match++;
+      const bool highlighted = match != matches.end() && *match <= offset;
+
+      char32_t c;
+      offset += DecodeUTF8(data + offset, next - offset, &c);
+
+      if (c == '\n' || c == '\r')
+        continue;
+      if (c == '\t') {
+        column = (column / kTabWidth + 1) * kTabWidth;
+        continue;
+      }
+      if (c < 0x20 || c == 0x7F)
+        c = 0xFFFD;
+      // wchar_t can't represent every character on every platform.
+      if (sizeof(wchar_t) == 2 && c > 0xFFFF)
+        c = 0xFFFD;
+
+      const int width = wchar_width(c);
+      if (width <= 0) {
+        // A combining character, attached to the previous one.
+        const int x = box_.x_min + column - 1 - left;
+        if (column > left && row.Contain(x))
+          row.PixelAt(x).character += wchar_t(c);
+        continue;
+      }
+      const int x = box_.x_min + column - left;
+      if (column >= left && column + width <= right && row.Contain(x)) {
+        Pixel& pixel = row.PixelAt(x);
+        pixel.character = wchar_t(c);
+        if (highlighted)
+          pixel.inverted = true;
+      }
+      column += width;
+    }
+    return next;
+  }
+
+  std::shared_ptr<PagerState> state_;
+};
+
+/// @brief Display a file, possibly a very large one.
+/// @ingroup component
+class PagerBase : public ComponentBase {
+ public:
+  PagerBase(const std::string& path, Ref<PagerOption> option)
+      : path_(path),
+        option_(std::move(option)),
+        state_(std::make_shared<PagerState>(path,
+                                            option_->on_index_progress,
+                                            option_->on_search_done)) {}
+
+ private:
+  Element Render() override {
+    if (state_->pending_line != -1 &&
+        (state_->pending_line < state_->index.lines() ||
+         state_->index.done())) {
+      state_->JumpTo(state_->pending_line);
+    }
+
+    TakeMatches();
+
+    Element view;
+    if (state_->file.valid())
+      view = std::make_shared<PagerView>(state_);
+    else
+      view = text(L"Can't open the file.") | flex;
+
+    return vbox({
+               view,
+               hbox({
+                   text(searching_ ? L"/" + typed_ : to_wstring(path_)),
+                   filler(),
+                   text(Status()),
+               }) | inverted,
+           }) |
+           reflect(box_);
+  }
+
+  std::wstring Status() {
+    const LineIndex& index = state_->index;
+    std::wstring status;
+    if (state_->searching) {
+      status += L" searching";
+    } else if (!state_->query.empty()) {
+      status += L" " + to_wstring(state_->matches.size()) +
+                (state_->all_matches ? L"" : L"+") + L" matches";
+    }
+    int line = index.LineOf(state_->top);
+    status += L" line " + (line == -1 ? L"?" : to_wstring(line + 1));
+    status += L"/" + to_wstring(index.lines()) + (index.done() ? L"" : L"+");
+    if (state_->size()) {
+      size_t percent = state_->top * 100 / state_->size();
+      status += L" " + to_wstring(percent) + L"%";
+    }
+    return status + L" ";
+  }
+
+  // The number typed before a command, or |default_value|.
+  int TakeCount(int default_value) {
+    int count = count_.empty() ? default_value : std::stoi(count_);
+    count_.clear();
+    return count;
+  }
+
+  // The number of lines of the pages to scroll by. It saturates instead of
+  // overflowing.
+  int TakePages() {
+    const int page = std::max(state_->height, 1);
+    const int count = TakeCount(1);
+    return count > INT_MAX / page ? INT_MAX : count * page;
+  }
+
+  // The view follows the search, once its matches are found.
+  void TakeMatches() {
+    if (state_->TakeMatches() && !state_->JumpToMatch(search_start_))
+      state_->MoveTo(search_start_);
+  }
+
+  bool OnEvent(Event event) override {
+    TakeMatches();
+
+    if (event.is_mouse())
+      return OnMouseEvent(event);
+
+    if (!Focused())
+      return false;
+
+    if (searching_)
+      return OnSearchEvent(event);
+
+    if (event.is_character() && event.character() >= L'0' &&
+        event.character() <= L'9') {
+      if (count_.size() < 9)
+        count_ += char(event.character());
+      return true;
+    }
+
+    if (event == Event::ArrowDown || event == Event::Character('j') ||
+        event == Event::Return) {
+      state_->MoveDown(TakeCount(1));
+      return true;
+    }
+
+    if (event == Event::ArrowUp || event == Event::Character('k')) {
+      state_->MoveUp(TakeCount(1));
+      return true;
+    }
+
+    if (event == Event::PageDown || event == Event::Character(' ') ||
+        event == Event::Character('f')) {
+      state_->MoveDown(TakePages());
+      return true;
+    }
+
+    if (event == Event::PageUp || event == Event::Character('b')) {
+      state_->MoveUp(TakePages());
+      return true;
+    }
+
+    if (event == Event::Home || event == Event::Character('g')) {
+      state_->JumpTo(TakeCount(1) - 1);
+      return true;
+    }
+
+    if (event == Event::End || event == Event::Character('G')) {
+      int line = TakeCount(0);
+      if (line)
+        state_->JumpTo(line - 1);
+      else
+        state_->JumpToPercent(100);
+      return true;
+    }
+
+    if (event == Event::Character('%')) {
+      state_->JumpToPercent(TakeCount(0));
+      return true;
+    }
+
+    if (event == Event::ArrowLeft || event == Event::Character('h')) {
+      state_->left = std::max(0, state_->left - TakeCount(kTabWidth));
+      return true;
+    }
+
+    if (event == Event::ArrowRight || event == Event::Character('l')) {
+      state_->left = std::min(kMaxLeft, state_->left + TakeCount(kTabWidth));
+      return true;
+    }
+
+    if (event == Event::Character('/')) {
+      count_.clear();
+      searching_ = true;
+      typed_.clear();
+      search_start_ = state_->top;
+      return true;
+    }
+
+    if (event == Event::Character('n')) {
+      state_->NextMatch(TakeCount(1));
+      return true;
+    }
+
+    if (event == Event::Character('N')) {
+      state_->PreviousMatch(TakeCount(1));
+      return true;
+    }
+
+    if (event == Event::Escape && !count_.empty()) {
+      count_.clear();
+      return true;
+    }
+
+    return false;
+  }
+
+  // Typing the searched string. The view jumps to the first match as it is
+  // typed, or once it is found.
+  bool OnSearchEvent(Event event) {
+    if (event == Event::Return) {
+      searching_ = false;
+      return true;
+    }
+
+    if (event == Event::Escape) {
+      searching_ = false;
+      state_->Search("");
+      state_->MoveTo(search_start_);
+      return true;
+    }
+
+    if (event == Event::Backspace) {
+      if (!typed_.empty())
+        typed_.pop_back();
+    } else if (event.is_character()) {
+      typed_ += event.character();
+    } else {
+      return false;
+    }
+
+    state_->Search(to_string(typed_));
+    if (!state_->searching && !state_->JumpToMatch(search_start_))
+      state_->MoveTo(search_start_);
+    return true;
+  }
+
+  bool OnMouseEvent(Event event) {
+    if (!box_.Contain(event.mouse().x, event.mouse().y))
+      return false;
+    if (!CaptureMouse(event))
+      return false;
+
+    if (event.mouse().button == Mouse::WheelDown) {
+      state_->MoveDown(kWheelLines);
+      return true;
+    }
+    if (event.mouse().button == Mouse::WheelUp) {
+      state_->MoveUp(kWheelLines);
+      return true;
+    }
+    if (event.mouse().button == Mouse::Left &&
+        event.mouse().motion == Mouse::Pressed) {
+      TakeFocus();
+      return true;
+    }
+    return false;
+  }
+
+  std::string path_;
+  Ref<PagerOption> option_;
+  std::shared_ptr<PagerState> state_;
+  std::string count_;
+  Box box_;
+
+  bool searching_ = false;
+  std::wstring typed_;
+  size_t search_start_ = 0;  // The top of the view when the search began.
+};
+
+}  // namespace
+
+/// @brief A pager, displaying a file.
+///
+/// The file is mapped into memory, and its lines are indexed by a background
+/// thread. Only the visible lines are read and decoded, so very large files
+/// open immediately. The user can jump to a line, or to a percentage of the
+/// file, before the indexing completes.
+///
+/// From the first search, another thread indexes the trigrams of the first
+/// 512 MiB of the file, by blocks. A search scans only the blocks which can
+/// contain the string, on a thread of its own, so the UI stays responsive.
+/// Typing more characters only filters the previous matches. Only the matches
+/// visible are highlighted.
+///
+/// The keys are the ones of `less`:
+/// - j, k, h, l, the arrows: Scroll by one line vertically, or by 8 columns
+///   horizontally. A number N typed before scrolls by N lines or columns.
+/// - space, f, b, PageDown, PageUp: Scroll by one page.
+/// - [N]g, Home: Go to the line N, or to the first one.
+/// - [N]G, End: Go to the line N, or to the last one.
+/// - N%: Go to N percent of the file.
+/// - /: Search a string, as it is typed. Return ends the search.
+/// - n, N: Go to the next or the previous match.
+///
+/// @param path The file to display.
+/// @param option Additional optional parameters.
+/// @ingroup component
+/// @see PagerBase
+///
+/// ### Example
+///
+/// ```cpp
+/// auto screen = ScreenInteractive::Fullscreen();
+/// PagerOption option;
+/// option.on_index_progress = [&] { screen.PostEvent(Event::Custom); };
+/// option.on_search_done = [&] { screen.PostEvent(Event::Custom); };
+/// screen.Loop(Pager("/var/log/syslog", &option));
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// Jun 21 10:15:01 host CRON[1234]: (root) CMD (command -v debian-sa1)
+/// Jun 21 10:17:01 host CRON[1250]: (root) CMD (cd / && run-parts --report)
+/// /var/log/syslog                                         line 1/4096+ 0%
+/// ```
+Component Pager(const std::string& path, Ref<PagerOption> option) {
+  return Make<PagerBase>(path, std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
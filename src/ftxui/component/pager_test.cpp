@@ -0,0 +1,217 @@
+#include <gtest/gtest-message.h>  // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult, SuiteApiResolver, TestFactoryImpl
+#include <atomic>                   // for atomic
+#include <chrono>                   // for seconds, steady_clock
+#include <cstdio>                   // for remove
+#include <fstream>                  // for ofstream
+#include <memory>  // for __shared_ptr_access, shared_ptr, allocator
+#include <string>  // for string, wstring
+#include <thread>  // for yield
+
+#include "ftxui/component/captured_mouse.hpp"     // for ftxui
+#include "ftxui/component/component.hpp"          // for Pager
+#include "ftxui/component/component_base.hpp"     // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for PagerOption
+#include "ftxui/component/event.hpp"  // for Event, Event::ArrowDown, Event::ArrowUp, Event::End, Event::Home, Event::Backspace, Event::Escape, Event::Return
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for AssertionResult, EXPECT_EQ, Test, TEST, ASSERT_TRUE
+
+using namespace ftxui;
+
+namespace {
+
+// Wait for |flag| to be set by another thread, for a few seconds at most.
+testing::AssertionResult WaitFor(const std::atomic<bool>& flag) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!flag) {
+    if (std::chrono::steady_clock::now() > deadline)
+      return testing::AssertionFailure() << "timed out";
+    std::this_thread::yield();
+  }
+  return testing::AssertionSuccess();
+}
+
+// A temporary file holding the lines "0" to "99".
+class PagerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "ftxui_pager_test.txt";
+    std::ofstream file(path_);
+    for (int i = 0; i < 100; ++i)
+      file << i << "\n";
+  }
+
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  // Create a pager. |indexed_| is set once the file is indexed.
+  Component Create() {
+    indexed_ = false;
+    option_.on_index_progress = [this] { indexed_ = true; };
+    option_.on_search_done = [this] { searched_ = true; };
+    return Pager(path_, &option_);
+  }
+
+  // Send |event|, starting a search, and wait for its matches to be found.
+  testing::AssertionResult Search(Component pager, Event event) {
+    searched_ = false;
+    pager->OnEvent(event);
+    return WaitFor(searched_);
+  }
+
+  // The first characters of the line |y|.
+  std::wstring Line(Component pager, int y) {
+    Screen screen(4, 4);
+    Render(screen, pager->Render());
+    std::wstring line;
+    for (int x = 0; x < screen.dimx(); ++x)
+      line += screen.at(x, y);
+    return line;
+  }
+
+  std::string path_;
+  PagerOption option_;
+  std::atomic<bool> indexed_;
+  std::atomic<bool> searched_;
+};
+
+}  // namespace
+
+TEST_F(PagerTest, Scroll) {
+  auto pager = Create();
+  ASSERT_TRUE(WaitFor(indexed_));
+  EXPECT_EQ(Line(pager, 0), L"0   ");
+  EXPECT_EQ(Line(pager, 2), L"2   ");
+
+  pager->OnEvent(Event::ArrowDown);
+  EXPECT_EQ(Line(pager, 0), L"1   ");
+  pager->OnEvent(Event::Character(' '));
+  EXPECT_EQ(Line(pager, 0), L"4   ");
+  pager->OnEvent(Event::Character('b'));
+  EXPECT_EQ(Line(pager, 0), L"1   ");
+  pager->OnEvent(Event::ArrowUp);
+  pager->OnEvent(Event::ArrowUp);
+  EXPECT_EQ(Line(pager, 0), L"0   ");
+}
+
+TEST_F(PagerTest, ScrollHorizontally) {
+  auto pager = Create();
+  ASSERT_TRUE(WaitFor(indexed_));
+  auto type = [&](const std::string& keys) {
+    for (char key : keys)
+      pager->OnEvent(Event::Character(key));
+  };
+  type("11g1l");
+  EXPECT_EQ(Line(pager, 0), L"0   ");
+  pager->OnEvent(Event::ArrowLeft);
+  EXPECT_EQ(Line(pager, 0), L"10  ");
+
+  // Scrolling right stops far away, so a single large step comes back.
+  type("999999999l999999999l999999999h");
+  EXPECT_EQ(Line(pager, 0), L"10  ");
+}
+
+TEST_F(PagerTest, Jump) {
+  auto pager = Create();
+  ASSERT_TRUE(WaitFor(indexed_));
+  Line(pager, 0);
+
+  pager->OnEvent(Event::Character('4'));
+  pager->OnEvent(Event::Character('2'));
+  pager->OnEvent(Event::Character('g'));
+  EXPECT_EQ(Line(pager, 0), L"41  ");
+
+  // The last page is full.
+  pager->OnEvent(Event::End);
+  EXPECT_EQ(Line(pager, 0), L"97  ");
+  EXPECT_EQ(Line(pager, 2), L"99  ");
+  pager->OnEvent(Event::ArrowDown);
+  EXPECT_EQ(Line(pager, 0), L"97  ");
+
+  pager->OnEvent(Event::Home);
+  EXPECT_EQ(Line(pager, 0), L"0   ");
+
+  pager->OnEvent(Event::Character('5'));
+  pager->OnEvent(Event::Character('0'));
+  pager->OnEvent(Event::Character('%'));
+  EXPECT_EQ(Line(pager, 0), L"51  ");
+}
+
+TEST_F(PagerTest, Search) {
+  auto pager = Create();
+  ASSERT_TRUE(WaitFor(indexed_));
+  Line(pager, 0);
+
+  // The view follows the string as it is typed. The longer string only filters
+  // the matches of the shorter one, without searching again.
+  pager->OnEvent(Event::Character('/'));
+  ASSERT_TRUE(Search(pager, Event::Character('5')));
+  EXPECT_EQ(Line(pager, 0), L"5   ");
+  pager->OnEvent(Event::Character('0'));
+  EXPECT_EQ(Line(pager, 0), L"50  ");
+  ASSERT_TRUE(Search(pager, Event::Backspace));
+  EXPECT_EQ(Line(pager, 0), L"5   ");
+  pager->OnEvent(Event::Return);
+
+  pager->OnEvent(Event::Character('n'));
+  EXPECT_EQ(Line(pager, 0), L"15  ");
+  pager->OnEvent(Event::Character('3'));
+  pager->OnEvent(Event::Character('n'));
+  EXPECT_EQ(Line(pager, 0), L"45  ");
+  pager->OnEvent(Event::Character('N'));
+  EXPECT_EQ(Line(pager, 0), L"35  ");
+
+  // Only the matching characters are highlighted.
+  Screen screen(4, 4);
+  Render(screen, pager->Render());
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+  EXPECT_TRUE(screen.PixelAt(1, 0).inverted);
+
+  // Escape goes back to where the search began.
+  pager->OnEvent(Event::Character('/'));
+  ASSERT_TRUE(Search(pager, Event::Character('9')));
+  EXPECT_EQ(Line(pager, 0), L"39  ");
+  pager->OnEvent(Event::Escape);
+  EXPECT_EQ(Line(pager, 0), L"35  ");
+}
+
+// Large counts stop at the ends of the file, without overflowing.
+TEST_F(PagerTest, LargeCount) {
+  auto pager = Create();
+  ASSERT_TRUE(WaitFor(indexed_));
+  auto type = [&](const std::string& keys) {
+    for (char key : keys)
+      pager->OnEvent(Event::Character(key));
+  };
+  Line(pager, 0);
+
+  type("999999999");
+  pager->OnEvent(Event::PageDown);
+  EXPECT_EQ(Line(pager, 0), L"97  ");
+  type("999999999");
+  pager->OnEvent(Event::PageUp);
+  EXPECT_EQ(Line(pager, 0), L"0   ");
+  type("999999999j");
+  EXPECT_EQ(Line(pager, 0), L"97  ");
+  type("999999999k");
+  EXPECT_EQ(Line(pager, 0), L"0   ");
+
+  pager->OnEvent(Event::Character('/'));
+  ASSERT_TRUE(Search(pager, Event::Character('1')));
+  pager->OnEvent(Event::Return);
+  type("999999999n");
+  EXPECT_EQ(Line(pager, 0), L"91  ");
+  type("999999999N");
+  EXPECT_EQ(Line(pager, 0), L"1   ");
+}
+
+TEST(PagerTestNoFile, Invalid) {
+  auto pager = Pager("/this/file/does/not/exist");
+  Screen screen(12, 2);
+  Render(screen, pager->Render());
+  EXPECT_EQ(screen.at(0, 0), L'C');
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -15,6 +15,7 @@
 #include "ftxui/component/screen_interactive.hpp"  // for Component
 #include "ftxui/dom/elements.hpp"  // for Element, operator|, text, hbox, reflect, vbox, focus, nothing, select
 #include "ftxui/screen/box.hpp"  // for Box
+#include "ftxui/screen/interned_string.hpp"  // for InternedString
 #include "ftxui/util/ref.hpp"    // for Ref
 
 namespace ftxui {
@@ -23,9 +24,10 @@ namespace {
 /// @brief A list of selectable element. One and only one can be selected at
 /// the same time.
 /// @ingroup component
+template <typename Entry>  // Entry = {std::wstring, InternedString}
 class RadioboxBase : public ComponentBase {
  public:
-  RadioboxBase(const std::vector<std::wstring>* entries,
+  RadioboxBase(const std::vector<Entry>* entries,
                int* selected,
                Ref<RadioboxOption> option)
       : entries_(entries), selected_(selected), option_(std::move(option)) {
@@ -122,7 +124,7 @@ class RadioboxBase : public ComponentBase {
 
   int& focused_entry() { return option_->focused_entry(); }
 
-  const std::vector<std::wstring>* const entries_;
+  const std::vector<Entry>* const entries_;
   int* const selected_;
 
   int cursor_position = 0;
@@ -163,7 +165,20 @@ class RadioboxBase : public ComponentBase {
 Component Radiobox(const std::vector<std::wstring>* entries,
                    int* selected,
                    Ref<RadioboxOption> option) {
-  return Make<RadioboxBase>(entries, selected, std::move(option));
+  return Make<RadioboxBase<std::wstring>>(entries, selected, std::move(option));
+}
+
+/// @brief A list of interned elements, where only one can be selected.
+/// @param entries The list of entries
+/// @param selected The index of the currently selected element.
+/// @param option Additional optional parameters.
+/// @ingroup component
+/// @see InternedString
+Component Radiobox(const std::vector<InternedString>* entries,
+                   int* selected,
+                   Ref<RadioboxOption> option) {
+  return Make<RadioboxBase<InternedString>>(entries, selected,
+                                            std::move(option));
 }
 
 }  // namespace ftxui
@@ -16,8 +16,9 @@
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, MakeReceiver, Sender, SenderImpl, Receiver
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
-#include "ftxui/dom/node.hpp"                         // for Node, Render
+#include "ftxui/dom/node.hpp"                         // for Node, Render, RenderMeasured
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
 #include "ftxui/screen/terminal.hpp"  // for Terminal::Dimensions, Terminal
 
 #if defined(_WIN32)
@@ -382,8 +383,7 @@ void ScreenInteractive::Loop(Component component) {
 
   // The main loop.
   while (!quit_) {
-    if (!event_receiver_->HasPending()) {
-      Draw(component);
+    if (!event_receiver_->HasPending() && Draw(component)) {
       std::cout << ToString() << set_cursor_position;
       Flush();
       Clear();
@@ -412,10 +412,49 @@ void ScreenInteractive::Loop(Component component) {
   OnExit(0);
 }
 
-void ScreenInteractive::Draw(Component component) {
+// Return false when the frame is the same as the previous one. Nothing is
+// drawn then.
+bool ScreenInteractive::Draw(Component component) {
   auto document = component->Render();
+  auto terminal = Terminal::Size();
+
+  // Periodically request the terminal emulator the frame position relative to
+  // the screen. This is useful for converting mouse position reported in
+  // screen's coordinates to frame's coordinates. The request is sent from the
+  // top left of the frame: that frame is drawn, even if it didn't change.
+  static constexpr int cursor_refresh_rate =
+#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+      // Microsoft's terminal suffers from a [bug]. When reporting the cursor
+      // position, several output sequences are mixed together into garbage.
+      // This causes FTXUI user to see some "1;1;R" sequences into the Input
+      // component. See [issue]. Solution is to request cursor position less
+      // often. [bug]: https://github.com/microsoft/terminal/pull/7583 [issue]:
+      // https://github.com/ArthurSonzogni/FTXUI/issues/136
+      150;
+#else
+      20;
+#endif
+  static int i = -3;
+  ++i;
+  const bool report_cursor =
+      !use_alternative_screen_ && (i % cursor_refresh_rate == 0);
+
+  // The frames made of the same document, on the same terminal, are identical.
+  // This is the case of most of the events not handled by any component.
+  StructuralHash hash;
+  bool hashed = document->Hash(hash);
+  hash.Add(terminal.dimx);
+  hash.Add(terminal.dimy);
+  if (!report_cursor && hashed && previous_frame_hashed_ &&
+      hash.value() == previous_frame_hash_) {
+    return false;
+  }
+  previous_frame_hashed_ = hashed;
+  previous_frame_hash_ = hash.value();
+
   int dimx = 0;
   int dimy = 0;
+  bool measured = false;
   switch (dimension_) {
     case Dimension::Fixed:
       dimx = dimx_;
@@ -423,16 +462,17 @@ void ScreenInteractive::Draw(Component component) {
       break;
     case Dimension::TerminalOutput:
       document->ComputeRequirement();
-      dimx = Terminal::Size().dimx;
+      measured = true;
+      dimx = terminal.dimx;
       dimy = document->requirement().min_y;
       break;
     case Dimension::Fullscreen:
-      dimx = Terminal::Size().dimx;
-      dimy = Terminal::Size().dimy;
+      dimx = terminal.dimx;
+      dimy = terminal.dimy;
       break;
     case Dimension::FitComponent:
-      auto terminal = Terminal::Size();
       document->ComputeRequirement();
+      measured = true;
       dimx = std::min(document->requirement().min_x, terminal.dimx);
       dimy = std::min(document->requirement().min_y, terminal.dimy);
       break;
@@ -450,27 +490,13 @@ void ScreenInteractive::Draw(Component component) {
     cursor_.y = dimy_ - 1;
   }
 
-  // Periodically request the terminal emulator the frame position relative to
-  // the screen. This is useful for converting mouse position reported in
-  // screen's coordinates to frame's coordinates.
-  static constexpr int cursor_refresh_rate =
-#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
-      // Microsoft's terminal suffers from a [bug]. When reporting the cursor
-      // position, several output sequences are mixed together into garbage.
-      // This causes FTXUI user to see some "1;1;R" sequences into the Input
-      // component. See [issue]. Solution is to request cursor position less
-      // often. [bug]: https://github.com/microsoft/terminal/pull/7583 [issue]:
-      // https://github.com/ArthurSonzogni/FTXUI/issues/136
-      150;
-#else
-      20;
-#endif
-  static int i = -3;
-  ++i;
-  if (!use_alternative_screen_ && (i % cursor_refresh_rate == 0))
+  if (report_cursor)
     std::cout << DeviceStatusReport(DSRMode::kCursor);
 
-  Render(*this, document);
+  if (measured)
+    RenderMeasured(*this, document);
+  else
+    Render(*this, document);
 
   // Set cursor position for user using tools to insert CJK characters.
   set_cursor_position = "";
@@ -487,6 +513,7 @@ void ScreenInteractive::Draw(Component component) {
     set_cursor_position += "\x1B[" + std::to_string(dy) + "A";
     reset_cursor_position += "\x1B[" + std::to_string(dy) + "B";
   }
+  return true;
 }
 
 std::function<void()> ScreenInteractive::ExitLoopClosure() {
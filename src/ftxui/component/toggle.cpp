@@ -14,6 +14,7 @@
 #include "ftxui/component/mouse.hpp"  // for Mouse, Mouse::Left, Mouse::Pressed
 #include "ftxui/dom/elements.hpp"  // for operator|, Element, Elements, hbox, reflect, separator, text, focus, nothing, select
 #include "ftxui/screen/box.hpp"    // for Box
+#include "ftxui/screen/interned_string.hpp"  // for InternedString
 #include "ftxui/util/ref.hpp"      // for Ref
 
 namespace ftxui {
@@ -22,9 +23,10 @@ namespace {
 
 /// @brief An horizontal list of elements. The user can navigate through them.
 /// @ingroup component
+template <typename Entry>  // Entry = {std::wstring, InternedString}
 class ToggleBase : public ComponentBase {
  public:
-  ToggleBase(const std::vector<std::wstring>* entries,
+  ToggleBase(const std::vector<Entry>* entries,
              int* selected,
              Ref<ToggleOption> option)
       : entries_(entries), selected_(selected), option_(std::move(option)) {}
@@ -111,7 +113,7 @@ class ToggleBase : public ComponentBase {
 
   int& focused_entry() { return option_->focused_entry(); }
 
-  const std::vector<std::wstring>* const entries_;
+  const std::vector<Entry>* const entries_;
   int* selected_ = 0;
 
   std::vector<Box> boxes_;
@@ -128,7 +130,21 @@ class ToggleBase : public ComponentBase {
 Component Toggle(const std::vector<std::wstring>* entries,
                  int* selected,
                  Ref<ToggleOption> option) {
-  return Make<ToggleBase>(entries, selected, std::move(option));
+  return Make<ToggleBase<std::wstring>>(entries, selected, std::move(option));
+}
+
+/// @brief An horizontal list of interned elements. The user can navigate
+/// through them.
+/// @param entries The list of selectable entries to display.
+/// @param selected Reference the selected entry.
+/// @param option Additional optional parameters.
+/// @ingroup component
+/// @see InternedString
+Component Toggle(const std::vector<InternedString>* entries,
+                 int* selected,
+                 Ref<ToggleOption> option) {
+  return Make<ToggleBase<InternedString>>(entries, selected,
+                                          std::move(option));
 }
 
 }  // namespace ftxui
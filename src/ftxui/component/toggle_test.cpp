@@ -10,6 +10,9 @@
 #include "ftxui/component/component_base.hpp"     // for ComponentBase
 #include "ftxui/component/component_options.hpp"  // for ToggleOption
 #include "ftxui/component/event.hpp"  // for Event, Event::ArrowLeft, Event::ArrowRight, Event::Return, Event::Tab, Event::TabReverse
+#include "ftxui/dom/node.hpp"                 // for Render
+#include "ftxui/screen/interned_string.hpp"  // for InternedString
+#include "ftxui/screen/screen.hpp"           // for Screen
 #include "gtest/gtest_pred_impl.h"  // for AssertionResult, EXPECT_EQ, Test, EXPECT_TRUE, EXPECT_FALSE, TEST
 
 using namespace ftxui;
@@ -150,6 +153,22 @@ TEST(ToggleTest, OnEnter) {
   EXPECT_EQ(counter, 7);
 }
 
+TEST(ToggleTest, InternedEntries) {
+  std::vector<InternedString> entries = {
+      std::wstring(L"On"),
+      std::wstring(L"Off"),
+  };
+  int selected = 0;
+  auto toggle = Toggle(&entries, &selected);
+
+  toggle->OnEvent(Event::ArrowRight);
+  EXPECT_EQ(selected, 1);
+
+  Screen screen(6, 1);
+  Render(screen, toggle->Render());
+  EXPECT_EQ("On│\x1B[1m\x1B[7mOff\x1B[22m\x1B[27m", screen.ToString());
+}
+
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
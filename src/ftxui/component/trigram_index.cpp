@@ -0,0 +1,126 @@
+#include <algorithm>  // for min
+#include <cstring>    // for memchr, memcmp
+
+#include "ftxui/component/trigram_index.hpp"
+
+namespace ftxui {
+
+namespace {
+
+const size_t kWords = TrigramIndex::kBits / 64;
+
+// A hash of the 3 bytes at |data|, from 0 to kBits - 1.
+uint32_t Hash(const char* data) {
+  static_assert(TrigramIndex::kBits == 1 << 13, "The hash has 13 bits");
+  const uint32_t trigram = uint32_t(uint8_t(data[0])) << 16 |
+                           uint32_t(uint8_t(data[1])) << 8 |
+                           uint32_t(uint8_t(data[2]));
+  return (trigram * 2654435761u) >> 19;
+}
+
+}  // namespace
+
+TrigramIndex::TrigramIndex(const char* data, size_t size)
+    : data_(data),
+      size_(size),
+      blocks_((size + kBlockSize - 1) / kBlockSize),
+      indexable_(std::min(blocks_, size_t(kMaxBlocks))),
+      indexed_(0),
+      stop_(false) {}
+
+TrigramIndex::~TrigramIndex() {
+  stop_ = true;
+  if (thread_.joinable())
+    thread_.join();
+}
+
+void TrigramIndex::Start() {
+  if (thread_.joinable())
+    return;
+  bits_.assign(indexable_ * kWords, 0);
+  thread_ = std::thread(&TrigramIndex::Run, this);
+}
+
+void TrigramIndex::Run() {
+  // The last trigram starts 2 bytes before the end.
+  const size_t last = size_ >= 2 ? size_ - 2 : 0;
+  for (size_t block = 0; block < indexable_ && !stop_; ++block) {
+    uint64_t* bits = &bits_[block * kWords];
+    const size_t end = std::min((block + 1) * kBlockSize, last);
+    for (size_t i = block * kBlockSize; i < end; ++i) {
+      const uint32_t hash = Hash(data_ + i);
+      bits[hash / 64] |= uint64_t(1) << (hash % 64);
+    }
+    // The bits of the block must be visible before the block is used.
+    indexed_.store(block + 1, std::memory_order_release);
+  }
+}
+
+bool TrigramIndex::MayContain(size_t block,
+                              size_t last_block,
+                              uint32_t hash) const {
+  for (; block <= last_block; ++block) {
+    if (bits_[block * kWords + hash / 64] & (uint64_t(1) << (hash % 64)))
+      return true;
+  }
+  return false;
+}
+
+bool TrigramIndex::Find(const std::string& query,
+                        size_t limit,
+                        std::vector<size_t>* matches,
+                        const std::atomic<bool>* cancel) const {
+  if (query.empty())
+    return true;
+
+  std::vector<uint32_t> hashes;
+  for (size_t i = 0; i + 3 <= query.size(); ++i)
+    hashes.push_back(Hash(query.data() + i));
+
+  const size_t indexed = indexed_.load(std::memory_order_acquire);
+  for (size_t block = 0; block < blocks_; ++block) {
+    if (cancel && *cancel)
+      return false;
+
+    // The occurrences starting in this block.
+    const size_t begin = block * kBlockSize;
+    const size_t end = std::min(begin + kBlockSize, size_);
+
+    // Their trigrams start in this block, or in the next ones for the last
+    // occurrences.
+    if (!hashes.empty()) {
+      const size_t last_block = std::min(
+          blocks_ - 1, (end - 1 + query.size() - 3) / kBlockSize);
+      if (last_block < indexed) {
+        bool candidate = true;
+        for (uint32_t hash : hashes)
+          candidate = candidate && MayContain(block, last_block, hash);
+        if (!candidate)
+          continue;
+      }
+    }
+
+    size_t i = begin;
+    while (i < end) {
+      auto* found =
+          static_cast<const char*>(memchr(data_ + i, query[0], end - i));
+      if (!found)
+        break;
+      i = found - data_;
+      if (query.size() <= size_ - i &&
+          memcmp(found, query.data(), query.size()) == 0) {
+        if (matches->size() == limit)
+          return false;
+        matches->push_back(i);
+      }
+      i++;
+    }
+  }
+  return true;
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,71 @@
+#ifndef FTXUI_COMPONENT_TRIGRAM_INDEX_HPP
+#define FTXUI_COMPONENT_TRIGRAM_INDEX_HPP
+
+#include <stddef.h>  // for size_t
+#include <stdint.h>  // for uint32_t, uint64_t
+#include <atomic>    // for atomic
+#include <string>    // for string
+#include <thread>    // for thread
+#include <vector>    // for vector
+
+namespace ftxui {
+
+// The trigrams found in each block of a text, indexed by a background thread.
+// A search scans only the blocks that can contain every trigram of the string,
+// and the blocks not indexed yet.
+//
+// A block stores a set of the hashes of the trigrams starting in it, as
+// |kBits| bits. A clear bit proves its trigrams aren't there, a set one
+// doesn't prove anything. This costs one bit per two bytes of text, for the
+// first |kMaxBlocks| blocks only. The next ones are always scanned.
+class TrigramIndex {
+ public:
+  // |data| must outlive the index. Nothing is allocated nor indexed until
+  // Start().
+  TrigramIndex(const char* data, size_t size);
+  ~TrigramIndex();
+
+  TrigramIndex(const TrigramIndex&) = delete;
+  TrigramIndex& operator=(const TrigramIndex&) = delete;
+
+  // Start indexing, if not started yet. Find() can run meanwhile: the blocks
+  // are used once they are indexed.
+  void Start();
+  bool done() const { return indexed_ == indexable_; }
+
+  // Append to |matches| the offset of the occurrences of |query|, in order.
+  // Return false when there are more than |limit| of them, or when |*cancel|
+  // becomes true: only the first ones are appended.
+  bool Find(const std::string& query,
+            size_t limit,
+            std::vector<size_t>* matches,
+            const std::atomic<bool>* cancel = nullptr) const;
+
+  static const size_t kBlockSize = 16384;
+  static const size_t kBits = kBlockSize / 2;
+  // 32 MiB of bits, indexing the first 512 MiB of text.
+  static const size_t kMaxBlocks = 1 << 15;
+
+ private:
+  void Run();
+  bool MayContain(size_t block, size_t last_block, uint32_t hash) const;
+
+  const char* data_;
+  size_t size_;
+  size_t blocks_;
+  size_t indexable_;  // The number of blocks indexed, once done().
+
+  // kBits / 64 words per block. The first |indexed_| blocks are complete.
+  std::vector<uint64_t> bits_;
+  std::atomic<size_t> indexed_;
+  std::atomic<bool> stop_;
+  std::thread thread_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_COMPONENT_TRIGRAM_INDEX_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,111 @@
+#include <gtest/gtest-message.h>  // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult, SuiteApiResolver, TestFactoryImpl
+#include <stddef.h>                 // for size_t
+#include <algorithm>                // for find
+#include <atomic>                   // for atomic
+#include <chrono>                   // for seconds, steady_clock
+#include <random>                   // for mt19937
+#include <string>                   // for string
+#include <thread>                   // for yield
+#include <vector>                   // for vector
+
+#include "ftxui/component/trigram_index.hpp"  // for TrigramIndex
+#include "gtest/gtest_pred_impl.h"  // for AssertionResult, EXPECT_EQ, Test, EXPECT_TRUE, EXPECT_FALSE, TEST, ASSERT_TRUE
+
+using namespace ftxui;
+
+namespace {
+
+// Start indexing, and wait for the end, for a few seconds at most.
+testing::AssertionResult Wait(TrigramIndex& index) {
+  index.Start();
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!index.done()) {
+    if (std::chrono::steady_clock::now() > deadline)
+      return testing::AssertionFailure() << "timed out";
+    std::this_thread::yield();
+  }
+  return testing::AssertionSuccess();
+}
+
+std::vector<size_t> Occurrences(const std::string& text,
+                                const std::string& query) {
+  std::vector<size_t> out;
+  for (size_t i = text.find(query); i != std::string::npos;
+       i = text.find(query, i + 1)) {
+    out.push_back(i);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(TrigramIndexTest, Empty) {
+  TrigramIndex index(nullptr, 0);
+  ASSERT_TRUE(Wait(index));
+  std::vector<size_t> matches;
+  EXPECT_TRUE(index.Find("abc", 10, &matches));
+  EXPECT_TRUE(matches.empty());
+}
+
+// The same occurrences as a plain search, including the ones spanning several
+// blocks, while being indexed and after.
+TEST(TrigramIndexTest, SameAsSearch) {
+  std::mt19937 random(42);
+  std::string text;
+  for (size_t i = 0; i < 5 * TrigramIndex::kBlockSize; ++i)
+    text += "abcdefgh\n"[random() % 9];
+  const size_t boundary = 2 * TrigramIndex::kBlockSize;
+  std::string spanning = text.substr(boundary - 3, 7);
+
+  TrigramIndex index(text.data(), text.size());
+  for (int pass = 0; pass < 2; ++pass) {
+    for (std::string query : {"a", "ab", "abc", "hgfe", "abcdef", "zzz",
+                              spanning.c_str()}) {
+      std::vector<size_t> matches;
+      EXPECT_TRUE(index.Find(query, text.size(), &matches));
+      EXPECT_EQ(matches, Occurrences(text, query)) << query;
+    }
+    ASSERT_TRUE(Wait(index));
+  }
+  std::vector<size_t> matches;
+  index.Find(spanning, 10, &matches);
+  EXPECT_NE(std::find(matches.begin(), matches.end(), boundary - 3),
+            matches.end());
+}
+
+TEST(TrigramIndexTest, Limit) {
+  std::string text = "abab abab";
+  TrigramIndex index(text.data(), text.size());
+  ASSERT_TRUE(Wait(index));
+  std::vector<size_t> matches;
+  EXPECT_FALSE(index.Find("ab", 3, &matches));
+  EXPECT_EQ(matches, (std::vector<size_t>{0, 2, 5}));
+  matches.clear();
+  EXPECT_TRUE(index.Find("ab", 4, &matches));
+  EXPECT_EQ(matches.size(), 4u);
+}
+
+// Before the index is started, every block is scanned.
+TEST(TrigramIndexTest, NotStarted) {
+  std::string text = "abcd abcd";
+  TrigramIndex index(text.data(), text.size());
+  EXPECT_FALSE(index.done());
+  std::vector<size_t> matches;
+  EXPECT_TRUE(index.Find("bcd", 10, &matches));
+  EXPECT_EQ(matches, (std::vector<size_t>{1, 6}));
+}
+
+TEST(TrigramIndexTest, Cancel) {
+  std::string text = "abab abab";
+  TrigramIndex index(text.data(), text.size());
+  ASSERT_TRUE(Wait(index));
+  std::vector<size_t> matches;
+  std::atomic<bool> cancel(true);
+  EXPECT_FALSE(index.Find("ab", 10, &matches, &cancel));
+  EXPECT_TRUE(matches.empty());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,33 +1,14 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, unpack, Elements, blink
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, blink
+#include "ftxui/dom/style.hpp"     // for Apply, kBlink
 
 namespace ftxui {
 
-class Blink : public NodeDecorator {
- public:
-  Blink(Elements children) : NodeDecorator(std::move(children)) {}
-  ~Blink() override {}
-
-  void Render(Screen& screen) override {
-    Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).blink = true;
-      }
-    }
-  }
-};
-
 /// @brief The text drawn alternates in between visible and hidden.
 /// @ingroup dom
 Element blink(Element child) {
-  return std::make_shared<Blink>(unpack(std::move(child)));
+  return style::Apply(std::move(child), style::kBlink);
 }
 
 }  // namespace ftxui
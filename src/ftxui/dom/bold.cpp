@@ -1,33 +1,14 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, unpack, Elements, bold
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, bold
+#include "ftxui/dom/style.hpp"     // for Apply, kBold
 
 namespace ftxui {
 
-class Bold : public NodeDecorator {
- public:
-  Bold(Elements children) : NodeDecorator(std::move(children)) {}
-  ~Bold() override {}
-
-  void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).bold = true;
-      }
-    }
-    Node::Render(screen);
-  }
-};
-
 /// @brief Use a bold font, for elements with more emphasis.
 /// @ingroup dom
 Element bold(Element child) {
-  return std::make_shared<Bold>(unpack(std::move(child)));
+  return style::Apply(std::move(child), style::kBold);
 }
 
 }  // namespace ftxui
@@ -1,14 +1,13 @@
 #include <algorithm>  // for max
-#include <iterator>   // for begin, end
 #include <memory>     // for make_shared, __shared_ptr_access
 #include <utility>    // for move
 #include <vector>     // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for unpack, Element, Decorator, Elements, border, borderWith, window
+#include "ftxui/dom/elements.hpp"  // for Element, Decorator, border, borderWith, window
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
+#include "ftxui/screen/screen.hpp"    // for Pixel, Screen, RowWriter
 
 namespace ftxui {
 
@@ -16,16 +15,23 @@ static wchar_t simple_border_charset[] = L"┌┐└┘─│┬┴┤├";
 
 class Border : public Node {
  public:
-  Border(Elements children)
-      : Node(std::move(children)),
-        charset(std::begin(simple_border_charset),
-                std::end(simple_border_charset)) {}
-  Border(Elements children, Pixel pixel)
-      : Node(std::move(children)), charset_pixel(10, pixel) {}
+  Border(Element child) : Node(std::move(child)) {}
+  Border(Element child, Element title) : Node(std::move(child)) {
+    children_.push_back(std::move(title));
+  }
+  Border(Element child, Pixel pixel)
+      : Node(std::move(child)), charset_pixel(10, pixel), charset(nullptr) {}
   ~Border() override {}
 
   std::vector<Pixel> charset_pixel;
-  std::vector<wchar_t> charset;
+  const wchar_t* charset = simple_border_charset;
+
+  bool Hash(StructuralHash& hash) override {
+    hash.AddPointer(charset);
+    for (const Pixel& pixel : charset_pixel)
+      hash.Add(pixel);
+    return HashChildren(hash);
+  }
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -67,45 +73,47 @@ class Border : public Node {
     if (box_.x_min >= box_.x_max || box_.y_min >= box_.y_max)
       return;
 
-    if (!charset.empty())
+    if (charset)
       RenderPixel(screen);
     else
       RenderChar(screen);
   }
 
   void RenderPixel(Screen& screen) {
-    screen.at(box_.x_min, box_.y_min) = charset[0];
-    screen.at(box_.x_max, box_.y_min) = charset[1];
-    screen.at(box_.x_min, box_.y_max) = charset[2];
-    screen.at(box_.x_max, box_.y_max) = charset[3];
-    for (float x = box_.x_min + 1; x < box_.x_max; ++x) {
-      screen.at(x, box_.y_min) = charset[4];
-      screen.at(x, box_.y_max) = charset[4];
-    }
-    for (float y = box_.y_min + 1; y < box_.y_max; ++y) {
-      screen.at(box_.x_min, y) = charset[5];
-      screen.at(box_.x_max, y) = charset[5];
-    }
+    DrawBorder(screen, charset);
 
     // Draw title.
     if (children_.size() == 2)
       children_[1]->Render(screen);
   }
 
-  void RenderChar(Screen& screen) {
-    screen.PixelAt(box_.x_min, box_.y_min) = charset_pixel[0];
-    screen.PixelAt(box_.x_max, box_.y_min) = charset_pixel[1];
-    screen.PixelAt(box_.x_min, box_.y_max) = charset_pixel[2];
-    screen.PixelAt(box_.x_max, box_.y_max) = charset_pixel[3];
-    for (float x = box_.x_min + 1; x < box_.x_max; ++x) {
-      screen.PixelAt(x, box_.y_min) = charset_pixel[4];
-      screen.PixelAt(x, box_.y_max) = charset_pixel[4];
+  void RenderChar(Screen& screen) { DrawBorder(screen, charset_pixel.data()); }
+
+  // Draw the border, with the cells |cells|, in the order of
+  // simple_border_charset. Each row is clipped once.
+  template <class Cell>
+  void DrawBorder(Screen& screen, const Cell* cells) {
+    for (int y : {box_.y_min, box_.y_max}) {
+      const bool top = y == box_.y_min;
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        const Cell& cell = x == box_.x_min   ? cells[top ? 0 : 2]
+                           : x == box_.x_max ? cells[top ? 1 : 3]
+                                             : cells[4];
+        SetCell(row.PixelAt(x), cell);
+      }
     }
-    for (float y = box_.y_min + 1; y < box_.y_max; ++y) {
-      screen.PixelAt(box_.x_min, y) = charset_pixel[5];
-      screen.PixelAt(box_.x_max, y) = charset_pixel[5];
+    for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      if (row.Contain(box_.x_min))
+        SetCell(row.PixelAt(box_.x_min), cells[5]);
+      if (row.Contain(box_.x_max))
+        SetCell(row.PixelAt(box_.x_max), cells[5]);
     }
   }
+
+  static void SetCell(Pixel& pixel, wchar_t c) { pixel.character[0] = c; }
+  static void SetCell(Pixel& pixel, const Pixel& cell) { pixel = cell; }
 };
 /// @brief Draw a border around the element.
 /// @ingroup dom
@@ -130,7 +138,7 @@ class Border : public Node {
 /// └───────────┘
 /// ```
 Element border(Element child) {
-  return std::make_shared<Border>(unpack(std::move(child)));
+  return std::make_shared<Border>(std::move(child));
 }
 
 /// @brief Draw window with a title and a border around the element.
@@ -155,7 +163,7 @@ Element border(Element child) {
 /// └───────┘
 /// ```
 Element window(Element title, Element content) {
-  return std::make_shared<Border>(unpack(std::move(content), std::move(title)));
+  return std::make_shared<Border>(std::move(content), std::move(title));
 }
 
 /// @brief Same as border but with a constant Pixel around the element.
@@ -163,7 +171,7 @@ Element window(Element title, Element content) {
 /// @see border
 Decorator borderWith(Pixel pixel) {
   return [pixel](Element child) {
-    return std::make_shared<Border>(unpack(std::move(child)), pixel);
+    return std::make_shared<Border>(std::move(child), pixel);
   };
 }
 
@@ -1,11 +1,12 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, clear_under
+#include "ftxui/dom/elements.hpp"  // for Element, clear_under
 #include "ftxui/dom/node.hpp"      // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/opaque_area.hpp"     // for OpaqueArea
 #include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen, RowWriter
 
 namespace ftxui {
 
@@ -13,14 +14,21 @@ using ftxui::Screen;
 
 class ClearUnder : public NodeDecorator {
  public:
-  ClearUnder(Elements children) : NodeDecorator(std::move(children)) {}
+  ClearUnder(Element child) : NodeDecorator(std::move(child)) {}
   ~ClearUnder() override {}
 
+  bool Hash(StructuralHash& hash) override { return HashChildren(hash); }
+
+  void SetBox(Box box) override {
+    NodeDecorator::SetBox(box);
+    OpaqueArea::Add(box);
+  }
+
   void Render(Screen& screen) override {
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = Pixel();
-      }
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x)
+        row.PixelAt(x) = Pixel();
     }
     Node::Render(screen);
   }
@@ -28,10 +36,13 @@ class ClearUnder : public NodeDecorator {
 
 /// @brief Before drawing |child|, clear the pixels below. This is useful in
 //         combinaison with dbox.
+///
+/// The layers of a dbox below |child| aren't drawn where it is, as they can't
+/// be seen.
 /// @see ftxui::dbox
 /// @ingroup dom
 Element clear_under(Element child) {
-  return std::make_shared<ClearUnder>(unpack(std::move(child)));
+  return std::make_shared<ClearUnder>(std::move(child));
 }
 
 }  // namespace ftxui
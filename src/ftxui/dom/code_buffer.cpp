@@ -0,0 +1,79 @@
+#include <algorithm>  // for min
+#include <mutex>      // for mutex, lock_guard
+#include <utility>    // for move
+
+#include "ftxui/dom/code_buffer.hpp"
+
+namespace ftxui {
+
+CodeBuffer::CodeBuffer(Lexer lexer, std::vector<std::wstring> lines)
+    : lexer_(std::move(lexer)),
+      lines_(std::move(lines)),
+      states_(lines_.size() + 1, 0),
+      dirty_(lines_.size(), true) {}
+
+void CodeBuffer::Set(int index, std::wstring line) {
+  lines_[index] = std::move(line);
+  dirty_[index] = true;
+  valid_ = std::min(valid_, index + 1);
+  version_++;
+}
+
+void CodeBuffer::Insert(int index, std::wstring line) {
+  lines_.insert(lines_.begin() + index, std::move(line));
+  // The new line begins where the line it pushes down began.
+  const int state = states_[index];
+  states_.insert(states_.begin() + index, state);
+  dirty_.insert(dirty_.begin() + index, true);
+  valid_ = std::min(valid_, index + 1);
+  version_++;
+}
+
+void CodeBuffer::Erase(int index) {
+  lines_.erase(lines_.begin() + index);
+  // The next line now begins where the erased one began.
+  states_.erase(states_.begin() + index + 1);
+  dirty_.erase(dirty_.begin() + index);
+  if (index < int(dirty_.size()))
+    dirty_[index] = true;
+  valid_ = std::min(valid_, index + 1);
+  version_++;
+}
+
+int CodeBuffer::State(int index) {
+  while (valid_ <= index) {
+    if (dirty_[valid_ - 1]) {
+      discarded_.clear();
+      Tokenize(valid_ - 1, &discarded_);
+    } else {
+      valid_++;
+    }
+  }
+  return states_[index];
+}
+
+void CodeBuffer::Tokenize(int index, std::vector<Span>* spans) {
+  const int state = lexer_(lines_[index], states_[index], spans);
+  tokenized_++;
+  if (index != valid_ - 1)
+    return;
+
+  dirty_[index] = false;
+  // The next line begins in a different state, it must be tokenized again.
+  if (state != states_[valid_] && valid_ < int(dirty_.size()))
+    dirty_[valid_] = true;
+  states_[valid_++] = state;
+}
+
+void CodeBuffer::Highlight(int index, std::vector<Span>* spans) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  spans->clear();
+  State(index);
+  Tokenize(index, spans);
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
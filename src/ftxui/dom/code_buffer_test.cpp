@@ -0,0 +1,161 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared
+#include <random>                   // for mt19937
+#include <string>                   // for wstring, to_wstring
+#include <vector>                   // for vector
+
+#include "ftxui/dom/code_buffer.hpp"  // for CodeBuffer
+#include "ftxui/dom/elements.hpp"     // for Span, code_view, operator|, yframe, hbox, flex
+#include "ftxui/dom/node.hpp"         // for Render, SetRenderThreads
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "gtest/gtest_pred_impl.h"    // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// A run per word. The words inside /* comments */ are dim. The state is 1
+// inside of a comment.
+int Lexer(const std::wstring& line, int state, std::vector<Span>* spans) {
+  size_t i = 0;
+  while (i < line.size()) {
+    size_t end = line.find(L' ', i);
+    if (end == std::wstring::npos)
+      end = line.size();
+    std::wstring word = line.substr(i, end - i);
+    if (word == L"/*")
+      state = 1;
+    Span span;
+    span.text = word + (end < line.size() ? L" " : L"");
+    span.dim = state == 1;
+    spans->push_back(span);
+    if (word == L"*/")
+      state = 0;
+    i = end + 1;
+  }
+  return state;
+}
+
+std::vector<std::wstring> Lines(int count) {
+  std::vector<std::wstring> lines;
+  for (int i = 0; i < count; ++i)
+    lines.push_back(L"line " + std::to_wstring(i));
+  return lines;
+}
+
+bool Dim(CodeBuffer& code, int line) {
+  std::vector<Span> spans;
+  code.Highlight(line, &spans);
+  return !spans.empty() && spans[0].dim;
+}
+
+}  // namespace
+
+TEST(CodeBufferTest, Highlight) {
+  CodeBuffer code(Lexer, {L"a /* b", L"c", L"d */ e", L"f"});
+  std::vector<Span> spans;
+  code.Highlight(2, &spans);
+  ASSERT_EQ(spans.size(), 3u);
+  EXPECT_EQ(spans[0].text, L"d ");
+  EXPECT_TRUE(spans[0].dim);
+  EXPECT_TRUE(spans[1].dim);
+  EXPECT_FALSE(spans[2].dim);
+  EXPECT_FALSE(Dim(code, 3));
+}
+
+TEST(CodeBufferTest, OnlyTheEditedLinesAreTokenized) {
+  CodeBuffer code(Lexer, Lines(1000));
+  Dim(code, 999);
+  EXPECT_EQ(code.tokenized(), 1000u);
+
+  // Without changing the state, only the edited line is tokenized again.
+  code.Set(500, L"edited");
+  Dim(code, 999);
+  EXPECT_EQ(code.tokenized(), 1002u);
+  code.Insert(100, L"inserted");
+  code.Erase(700);
+  Dim(code, 999);
+  EXPECT_EQ(code.tokenized(), 1005u);
+
+  // Opening a comment changes every line after it.
+  code.Set(10, L"/*");
+  EXPECT_TRUE(Dim(code, 999));
+  EXPECT_EQ(code.tokenized(), 1005u + 990u);
+  EXPECT_FALSE(Dim(code, 9));
+}
+
+// Random edits give the same highlighting as a new buffer.
+TEST(CodeBufferTest, SameAsNewBuffer) {
+  const std::wstring words[] = {L"a", L"/*", L"*/", L"b /* c", L"d */ e"};
+  std::mt19937 random(42);
+  std::vector<std::wstring> lines;
+  for (int i = 0; i < 50; ++i)
+    lines.push_back(words[random() % 5]);
+  CodeBuffer code(Lexer, lines);
+
+  for (int step = 0; step < 500; ++step) {
+    const int index = random() % lines.size();
+    std::wstring word = words[random() % 5];
+    switch (random() % 3) {
+      case 0:
+        lines[index] = word;
+        code.Set(index, word);
+        break;
+      case 1: {
+        const int at = random() % (lines.size() + 1);
+        lines.insert(lines.begin() + at, word);
+        code.Insert(at, word);
+        break;
+      }
+      case 2:
+        if (lines.size() > 1) {
+          lines.erase(lines.begin() + index);
+          code.Erase(index);
+        }
+        break;
+    }
+
+    CodeBuffer expected(Lexer, lines);
+    const int line = random() % lines.size();
+    ASSERT_EQ(Dim(code, line), Dim(expected, line)) << step;
+  }
+}
+
+TEST(CodeBufferTest, CodeView) {
+  auto code = std::make_shared<CodeBuffer>(Lexer, Lines(10000));
+  code->Set(5000, L"/* 5000");
+  Screen screen(10, 3);
+  Render(screen, code_view(code, 5001) | yframe);
+  EXPECT_EQ(screen.ToString(),
+            "\x1B[2m/* 5000\x1B[22m   \r\n"
+            "\x1B[2mline 5001\x1B[22m \r\n"
+            "\x1B[2mline 5002\x1B[22m ");
+  // Every line above the view, to find the state, then the visible ones.
+  EXPECT_EQ(code->tokenized(), 5003u);
+}
+
+// Two views of the same buffer, drawn in parallel.
+TEST(CodeBufferTest, SplitView) {
+  auto document = [] {
+    auto code = std::make_shared<CodeBuffer>(Lexer, Lines(10000));
+    code->Set(5000, L"/* 5000");
+    return hbox({
+        code_view(code, 5001) | yframe | flex,
+        code_view(code, 9000) | yframe | flex,
+    });
+  };
+  Screen expected(80, 40);
+  Render(expected, document());
+
+  SetRenderThreads(2);
+  Screen screen(80, 40);
+  Render(screen, document());
+  SetRenderThreads(0);
+  EXPECT_EQ(expected.ToString(), screen.ToString());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,129 @@
+#include <algorithm>  // for max, min
+#include <memory>     // for make_shared, shared_ptr
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/code_buffer.hpp"      // for CodeBuffer
+#include "ftxui/dom/elements.hpp"         // for Element, Span, code_view
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/requirement.hpp"      // for Requirement
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/color.hpp"         // for Color
+#include "ftxui/screen/screen.hpp"        // for Pixel, Screen, RowWriter
+#include "ftxui/screen/string.hpp"        // for wchar_width
+
+namespace ftxui {
+
+namespace {
+
+const int kTabWidth = 8;
+
+class CodeView : public Node {
+ public:
+  CodeView(std::shared_ptr<CodeBuffer> code, int selected_line)
+      : code_(std::move(code)), selected_line_(selected_line) {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.AddPointer(code_.get());
+    hash.Add(code_->version());
+    hash.Add(selected_line_);
+    return HashChildren(hash);
+  }
+
+  // Measuring the width of every line would cost as much as drawing them, the
+  // long lines are cut instead.
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = code_->size();
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+    if (selected_line_ >= 0 && selected_line_ < code_->size()) {
+      requirement_.selection = Requirement::SELECTED;
+      requirement_.selected_box = {0, 0, selected_line_, selected_line_};
+    }
+  }
+
+  // Only the lines within the stencil are tokenized, usually the ones visible
+  // through a frame.
+  void Render(Screen& screen) override {
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min({box_.y_max, screen.stencil.y_max,
+                                box_.y_min + code_->size() - 1});
+    thread_local std::vector<Span> spans;
+    for (int y = y_min; y <= y_max; ++y) {
+      code_->Highlight(y - box_.y_min, &spans);
+      RenderLine(screen, y, spans);
+    }
+  }
+
+ private:
+  void RenderLine(Screen& screen, int y, const std::vector<Span>& spans) {
+    RowWriter row(screen, y, box_.x_min, box_.x_max);
+    int x = box_.x_min;
+    for (const Span& span : spans) {
+      for (wchar_t c : span.text) {
+        if (x > box_.x_max)
+          return;
+        if (c == L'\t') {
+          x = box_.x_min + ((x - box_.x_min) / kTabWidth + 1) * kTabWidth;
+          continue;
+        }
+
+        const int width = wchar_width(c);
+        if (width <= 0) {
+          // A combining character, attached to the previous one.
+          if (row.Contain(x - 1))
+            row.PixelAt(x - 1).character += c;
+          continue;
+        }
+        if (x + width - 1 > box_.x_max)
+          return;
+        if (row.Contain(x)) {
+          Pixel& pixel = row.PixelAt(x);
+          pixel.character = c;
+          if (span.foreground != Color::Default)
+            pixel.foreground_color = span.foreground;
+          if (span.background != Color::Default)
+            pixel.background_color = span.background;
+          pixel.bold |= span.bold;
+          pixel.dim |= span.dim;
+          pixel.inverted |= span.inverted;
+          pixel.underlined |= span.underlined;
+          pixel.blink |= span.blink;
+        }
+        x += width;
+      }
+    }
+  }
+
+  std::shared_ptr<CodeBuffer> code_;
+  int selected_line_;
+};
+
+}  // namespace
+
+/// @brief Display the lines of a CodeBuffer, highlighted by its lexer.
+/// @param code The lines, and the cache of the lexer's states.
+/// @param selected_line The line a frame scrolls to.
+/// @ingroup dom
+///
+/// The element is as tall as the text. Only the lines drawn are tokenized, so
+/// inside a yframe, the cost of a frame depends on the size of the view, not
+/// the size of the text. The lines are drawn directly from the runs of the
+/// lexer, without building an element per line or per token.
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = code_view(code, cursor_line) | yframe | border;
+/// ```
+Element code_view(std::shared_ptr<CodeBuffer> code, int selected_line) {
+  return std::make_shared<CodeView>(std::move(code), selected_line);
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,49 +1,11 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Decorator, Elements, bgcolor, color
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/color.hpp"        // for Color
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/style.hpp"     // for ApplyBackground, ApplyForeground
+#include "ftxui/screen/color.hpp"  // for Color
 
 namespace ftxui {
 
-class BgColor : public NodeDecorator {
- public:
-  BgColor(Elements children, Color color)
-      : NodeDecorator(std::move(children)), color_(color) {}
-
-  void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).background_color = color_;
-      }
-    }
-    NodeDecorator::Render(screen);
-  }
-
-  Color color_;
-};
-
-class FgColor : public NodeDecorator {
- public:
-  FgColor(Elements children, Color color)
-      : NodeDecorator(std::move(children)), color_(color) {}
-  ~FgColor() override {}
-
-  void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).foreground_color = color_;
-      }
-    }
-    NodeDecorator::Render(screen);
-  }
-
-  Color color_;
-};
-
 /// @brief Set the foreground color of an element.
 /// @param color The color of the output element.
 /// @param child The input element.
@@ -56,7 +18,7 @@ class FgColor : public NodeDecorator {
 /// Element document = color(Color::Green, text(L"Success")),
 /// ```
 Element color(Color color, Element child) {
-  return std::make_shared<FgColor>(unpack(std::move(child)), color);
+  return style::ApplyForeground(std::move(child), color);
 }
 
 /// @brief Set the background color of an element.
@@ -71,7 +33,7 @@ Element color(Color color, Element child) {
 /// Element document = bgcolor(Color::Green, text(L"Success")),
 /// ```
 Element bgcolor(Color color, Element child) {
-  return std::make_shared<BgColor>(unpack(std::move(child)), color);
+  return style::ApplyBackground(std::move(child), color);
 }
 
 /// @brief Decorate using a foreground color.
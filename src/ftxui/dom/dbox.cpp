@@ -1,20 +1,60 @@
-#include <algorithm>  // for max
+#include <algorithm>  // for max, min
 #include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
 #include <utility>    // for move
 #include <vector>     // for vector
 
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, dbox
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/opaque_area.hpp"  // for OpaqueArea
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
 
 namespace ftxui {
 
+namespace {
+
+bool IsEmpty(const Box& box) {
+  return box.x_min > box.x_max || box.y_min > box.y_max;
+}
+
+// The smallest box containing |a| and |b|.
+Box Bounds(const Box& a, const Box& b) {
+  return {std::min(a.x_min, b.x_min), std::max(a.x_max, b.x_max),
+          std::min(a.y_min, b.y_min), std::max(a.y_max, b.y_max)};
+}
+
+// Remove |hole| from the disjoint |boxes|.
+void Subtract(std::vector<Box>* boxes, const Box& hole) {
+  std::vector<Box> out;
+  for (const Box& box : *boxes) {
+    Box inter = Box::Intersection(box, hole);
+    if (IsEmpty(inter)) {
+      out.push_back(box);
+      continue;
+    }
+    Box top = {box.x_min, box.x_max, box.y_min, inter.y_min - 1};
+    Box bottom = {box.x_min, box.x_max, inter.y_max + 1, box.y_max};
+    Box left = {box.x_min, inter.x_min - 1, inter.y_min, inter.y_max};
+    Box right = {inter.x_max + 1, box.x_max, inter.y_min, inter.y_max};
+    for (const Box& part : {top, bottom, left, right}) {
+      if (!IsEmpty(part))
+        out.push_back(part);
+    }
+  }
+  *boxes = std::move(out);
+}
+
+}  // namespace
+
 class DBox : public Node {
  public:
   DBox(Elements children) : Node(std::move(children)) {}
   ~DBox() {}
 
+  bool Hash(StructuralHash& hash) override { return HashChildren(hash); }
+
   void ComputeRequirement() override {
     requirement_.min_x = 0;
     requirement_.min_y = 0;
@@ -39,15 +79,77 @@ class DBox : public Node {
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    for (auto& child : children_)
-      child->SetBox(box);
+    opaque_boxes_.resize(children_.size());
+    for (size_t i = 0; i < children_.size(); ++i) {
+      OpaqueArea opaque_area;
+      children_[i]->SetBox(box);
+      opaque_boxes_[i] = opaque_area.boxes();
+    }
+  }
+
+  // The layers hidden by the opaque boxes of the layers above aren't drawn.
+  // The others are drawn once, clipped to the bounds of their visible part.
+  // The layers skipping what's outside of the stencil are drawn once per box of
+  // their visible part instead, so nothing is drawn below the opaque boxes.
+  void Render(Screen& screen) override {
+    // From the top layer to the bottom one, compute what's visible.
+    const Box area = Box::Intersection(box_, screen.stencil);
+    if (IsEmpty(area))
+      return;
+    std::vector<std::vector<Box>> stencils(children_.size());
+    std::vector<Box> occluders;
+    for (size_t i = children_.size(); i--;) {
+      stencils[i] = {area};
+      for (const Box& occluder : occluders)
+        Subtract(&stencils[i], occluder);
+      occluders.insert(occluders.end(), opaque_boxes_[i].begin(),
+                       opaque_boxes_[i].end());
+    }
+
+    for (size_t i = 0; i < children_.size(); ++i) {
+      const std::vector<Box>& boxes = stencils[i];
+      if (boxes.empty())
+        continue;
+      if (children_[i]->CullsByStencil()) {
+        for (const Box& box : boxes) {
+          AutoReset<Box> stencil(&screen.stencil, box);
+          children_[i]->Render(screen);
+        }
+        continue;
+      }
+      Box bounds = boxes[0];
+      for (const Box& box : boxes)
+        bounds = Bounds(bounds, box);
+      AutoReset<Box> stencil(&screen.stencil, bounds);
+      children_[i]->Render(screen);
+    }
   }
+
+ private:
+  // For every layer, the boxes it entirely overwrites.
+  std::vector<std::vector<Box>> opaque_boxes_;
 };
 
 /// @brief Stack several element on top of each other.
 /// @param children_ The input element.
 /// @return The right aligned element.
 /// @ingroup dom
+///
+/// A layer entirely hidden by the clear_under elements of the layers above
+/// isn't drawn. A layer partly hidden is drawn once, clipped to the bounds of
+/// its visible part. When it is an hbox, a vbox or a grid, it is drawn once per
+/// rectangle of its visible part instead, so its children below a dialog
+/// aren't drawn. To avoid drawing again the rest of a large background, keep
+/// it with a Reconciler: its cells are copied while it doesn't change.
+///
+/// ### Example
+///
+/// ```cpp
+/// dbox({
+///   reconciler.Keyed("background", version, [&] { return Background(); }),
+///   dialog | clear_under | center,
+/// });
+/// ```
 Element dbox(Elements children_) {
   return std::make_shared<DBox>(std::move(children_));
 }
@@ -0,0 +1,197 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared
+#include <string>                   // for allocator, basic_string, string
+#include <utility>                  // for move
+#include <vector>                   // for vector
+
+#include "ftxui/dom/elements.hpp"   // for text, operator|, Element, dbox
+#include "ftxui/dom/node.hpp"       // for Render, Node
+#include "ftxui/dom/reconciler.hpp"  // for Reconciler
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// Fill its box with |c|, and count the cells drawn within the stencil.
+class Fill : public Node {
+ public:
+  Fill(wchar_t c) : c_(c) {}
+
+  void Render(Screen& screen) override {
+    renders++;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+        cells += screen.stencil.Contain(x, y);
+        screen.at(x, y) = c_;
+      }
+    }
+  }
+
+  int renders = 0;
+  int cells = 0;
+
+ private:
+  wchar_t c_;
+};
+
+}  // namespace
+
+TEST(DBoxTest, Dialog) {
+  auto background = std::make_shared<Fill>(L'.');
+  auto document = dbox({
+      background,
+      text(L"hello") | clear_under | center,
+  });
+
+  Screen screen(9, 3);
+  Render(screen, document);
+  EXPECT_EQ(
+      ".........\r\n"
+      "..hello..\r\n"
+      ".........",
+      screen.ToString());
+  // Drawn once, around the dialog.
+  EXPECT_EQ(background->renders, 1);
+  EXPECT_EQ(background->cells, 9 * 3);
+}
+
+// The rows of a vbox are drawn once per side of the dialog, never below it.
+TEST(DBoxTest, DialogOverVBox) {
+  Elements rows;
+  std::vector<std::shared_ptr<Fill>> fills;
+  for (int i = 0; i < 3; ++i) {
+    fills.push_back(std::make_shared<Fill>(L'.'));
+    rows.push_back(fills.back() | yflex);
+  }
+  auto document = dbox({
+      vbox(std::move(rows)),
+      text(L"hello") | clear_under | center,
+  });
+
+  Screen screen(9, 3);
+  Render(screen, document);
+  EXPECT_EQ(
+      ".........\r\n"
+      "..hello..\r\n"
+      ".........",
+      screen.ToString());
+  EXPECT_EQ(fills[0]->renders, 1);
+  EXPECT_EQ(fills[1]->renders, 2);
+  EXPECT_EQ(fills[2]->renders, 1);
+  EXPECT_EQ(fills[0]->cells + fills[1]->cells + fills[2]->cells, 9 * 3 - 5);
+}
+
+// The opaque boxes of a cached dialog are known, even when it isn't laid out
+// again.
+TEST(DBoxTest, ReconciledDialog) {
+  Reconciler reconciler;
+  auto background = std::make_shared<Fill>(L'.');
+  auto document = [&] {
+    return dbox({
+        background,
+        reconciler.Keyed("dialog", 0,
+                         [] { return text(L"hello") | clear_under; }) |
+            center,
+    });
+  };
+
+  Screen screen(9, 3);
+  Render(screen, document());
+  Render(screen, document());
+  EXPECT_EQ(
+      ".........\r\n"
+      "..hello..\r\n"
+      ".........",
+      screen.ToString());
+  EXPECT_EQ(background->cells, 2 * 9 * 3);
+}
+
+// The cells of a cached background are copied, not drawn again.
+TEST(DBoxTest, ReconciledBackground) {
+  Reconciler reconciler;
+  auto background = std::make_shared<Fill>(L'.');
+  auto document = [&] {
+    return dbox({
+        reconciler.Keyed("background", 0, [&] { return background; }),
+        text(L"hello") | clear_under | center,
+    });
+  };
+
+  Screen screen(9, 3);
+  Render(screen, document());
+  EXPECT_EQ(background->renders, 1);
+  screen.Clear();
+  Render(screen, document());
+  EXPECT_EQ(background->renders, 1);
+  EXPECT_EQ(
+      ".........\r\n"
+      "..hello..\r\n"
+      ".........",
+      screen.ToString());
+}
+
+TEST(DBoxTest, HiddenLayer) {
+  auto background = std::make_shared<Fill>(L'.');
+  auto document = dbox({
+      background,
+      text(L"hello") | clear_under | flex,
+  });
+
+  Screen screen(9, 3);
+  Render(screen, document);
+  EXPECT_EQ(
+      "hello    \r\n"
+      "         \r\n"
+      "         ",
+      screen.ToString());
+  EXPECT_EQ(background->renders, 0);
+}
+
+TEST(DBoxTest, ClippedLayer) {
+  auto background = std::make_shared<Fill>(L'.');
+  auto document = dbox({
+      background,
+      hbox({
+          filler(),
+          text(L"side") | clear_under,
+      }),
+  });
+
+  Screen screen(9, 2);
+  Render(screen, document);
+  EXPECT_EQ(
+      ".....side\r\n"
+      ".....    ",
+      screen.ToString());
+  EXPECT_EQ(background->cells, 9 * 2 - 4 * 2);
+}
+
+TEST(DBoxTest, ClipInsideFrame) {
+  auto background = std::make_shared<Fill>(L'.');
+  auto document = dbox({
+      background,
+      hbox({
+          vbox({
+              text(L"a"),
+              text(L"b"),
+              text(L"c") | focus,
+          }) | clear_under | yframe,
+          filler(),
+      }),
+  });
+
+  Screen screen(3, 2);
+  Render(screen, document);
+  EXPECT_EQ(
+      "b..\r\n"
+      "c..",
+      screen.ToString());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,35 +1,14 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, unpack, Elements, dim
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, dim
+#include "ftxui/dom/style.hpp"     // for Apply, kDim
 
 namespace ftxui {
 
-using ftxui::Screen;
-
-class Dim : public NodeDecorator {
- public:
-  Dim(Elements children) : NodeDecorator(std::move(children)) {}
-  ~Dim() override {}
-
-  void Render(Screen& screen) override {
-    Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).dim = true;
-      }
-    }
-  }
-};
-
 /// @brief Use a light font, for elements with less emphasis.
 /// @ingroup dom
 Element dim(Element child) {
-  return std::make_shared<Dim>(unpack(std::move(child)));
+  return style::Apply(std::move(child), style::kDim);
 }
 
 }  // namespace ftxui
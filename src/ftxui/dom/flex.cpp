@@ -1,8 +1,9 @@
-#include <memory>   // for make_shared, __shared_ptr_access
-#include <utility>  // for move
-#include <vector>   // for vector, __alloc_traits<>::value_type
+#include <stdint.h>  // for uintptr_t
+#include <memory>    // for make_shared, __shared_ptr_access
+#include <utility>   // for move
+#include <vector>    // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
+#include "ftxui/dom/elements.hpp"  // for Element, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
 #include "ftxui/dom/node.hpp"      // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -68,8 +69,14 @@ void function_not_flex(Requirement& r) {
 class Flex : public Node {
  public:
   Flex(FlexFunction f) { f_ = f; }
-  Flex(FlexFunction f, Element child) : Node(unpack(std::move(child))), f_(f) {}
+  Flex(FlexFunction f, Element child) : Node(std::move(child)), f_(f) {}
   ~Flex() override {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(reinterpret_cast<uintptr_t>(f_));
+    return HashChildren(hash);
+  }
+
   void ComputeRequirement() override {
     requirement_.min_x = 0;
     requirement_.min_y = 0;
@@ -81,6 +88,7 @@ class Flex : public Node {
   }
 
   void SetBox(Box box) override {
+    Node::SetBox(box);
     if (children_.empty())
       return;
     children_[0]->SetBox(box);
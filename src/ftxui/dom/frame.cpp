@@ -3,8 +3,9 @@
 #include <utility>    // for move
 #include <vector>     // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, focus, frame, select, xframe, yframe
+#include "ftxui/dom/elements.hpp"  // for Element, focus, frame, select, xframe, yframe
 #include "ftxui/dom/node.hpp"  // for Node
+#include "ftxui/dom/opaque_area.hpp"  // for OpaqueArea
 #include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::FOCUSED, Requirement::SELECTED
 #include "ftxui/screen/box.hpp"      // for Box
 #include "ftxui/screen/screen.hpp"   // for Screen, Screen::Cursor
@@ -16,8 +17,9 @@ namespace ftxui {
 
 class Select : public Node {
  public:
-  Select(std::vector<std::shared_ptr<Node>> children)
-      : Node(std::move(children)) {}
+  Select(Element child) : Node(std::move(child)) {}
+
+  bool Hash(StructuralHash& hash) override { return HashChildren(hash); }
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -31,20 +33,20 @@ class Select : public Node {
   };
 
   void SetBox(Box box) override {
-    box_ = box;
+    Node::SetBox(box);
     children_[0]->SetBox(box);
   }
 };
 
 Element select(Element child) {
-  return std::make_shared<Select>(unpack(std::move(child)));
+  return std::make_shared<Select>(std::move(child));
 }
 
 // -----------------------------------------------------------------------------
 
 class Focus : public Select {
  public:
-  Focus(std::vector<Element> children) : Select(std::move(children)) {}
+  Focus(Element child) : Select(std::move(child)) {}
 
   void ComputeRequirement() override {
     Select::ComputeRequirement();
@@ -78,15 +80,21 @@ class Focus : public Select {
 };
 
 Element focus(Element child) {
-  return std::make_shared<Focus>(unpack(std::move(child)));
+  return std::make_shared<Focus>(std::move(child));
 }
 
 // -----------------------------------------------------------------------------
 
 class Frame : public Node {
  public:
-  Frame(std::vector<Element> children, bool x_frame, bool y_frame)
-      : Node(std::move(children)), x_frame_(x_frame), y_frame_(y_frame) {}
+  Frame(Element child, bool x_frame, bool y_frame)
+      : Node(std::move(child)), x_frame_(x_frame), y_frame_(y_frame) {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(x_frame_);
+    hash.Add(y_frame_);
+    return HashChildren(hash);
+  }
 
   void ComputeRequirement() override {
     Node::ComputeRequirement();
@@ -118,6 +126,8 @@ class Frame : public Node {
       children_box.y_max = box.y_min + internal_dimy - dy;
     }
 
+    // Only the part inside |box| is drawn.
+    OpaqueArea::Clip clip(box);
     children_[0]->SetBox(children_box);
   }
 
@@ -137,15 +147,15 @@ class Frame : public Node {
 /// displayed. The view is scrollable to make the focused element visible.
 /// @see focus
 Element frame(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, true);
+  return std::make_shared<Frame>(std::move(child), true, true);
 }
 
 Element xframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), true, false);
+  return std::make_shared<Frame>(std::move(child), true, false);
 }
 
 Element yframe(Element child) {
-  return std::make_shared<Frame>(unpack(std::move(child)), false, true);
+  return std::make_shared<Frame>(std::move(child), false, true);
 }
 
 }  // namespace ftxui
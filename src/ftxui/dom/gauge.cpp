@@ -4,7 +4,7 @@
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/screen.hpp"    // for Screen, RowWriter
 
 namespace ftxui {
 
@@ -21,6 +21,11 @@ class Gauge : public Node {
   Gauge(float progress) : progress_(progress) {}
   ~Gauge() override {}
 
+  bool Hash(StructuralHash& hash) override {
+    hash.AddFloat(progress_);
+    return HashChildren(hash);
+  }
+
   void ComputeRequirement() override {
     requirement_.flex_grow_x = 1;
     requirement_.flex_grow_y = 0;
@@ -31,15 +36,14 @@ class Gauge : public Node {
   }
 
   void Render(Screen& screen) override {
-    float y = box_.y_min;
     float limit = box_.x_min + progress_ * (box_.x_max - box_.x_min + 1);
     int limit_int = limit;
-    int x = box_.x_min;
-    while (x < limit_int)
-      screen.at(x++, y) = charset[9];
-    screen.at(x++, y) = charset[int(9 * (limit - limit_int))];
-    while (x <= box_.x_max)
-      screen.at(x++, y) = charset[0];
+    RowWriter row(screen, box_.y_min, box_.x_min, box_.x_max);
+    for (int x = row.x_min(); x <= row.x_max(); ++x) {
+      row.at(x) = x < limit_int    ? charset[9]
+                  : x == limit_int ? charset[int(9 * (limit - limit_int))]
+                                   : charset[0];
+    }
   }
 
  private:
@@ -0,0 +1,283 @@
+#include <stddef.h>   // for size_t
+#include <algorithm>  // for max, min
+#include <cmath>      // for cos, sin, sqrt
+#include <memory>     // for make_shared, shared_ptr
+#include <mutex>      // for mutex, lock_guard
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"  // for Element, Decorator, color_gradient, bgcolor_gradient, color_radial_gradient, bgcolor_radial_gradient, color_blend, bgcolor_blend
+#include "ftxui/dom/node_decorator.hpp"   // for NodeDecorator
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/color.hpp"         // for Color
+#include "ftxui/screen/color_map.hpp"     // for ColorMap
+#include "ftxui/screen/screen.hpp"        // for Pixel, Screen, RowWriter
+#include "ftxui/screen/terminal.hpp"      // for Terminal
+
+namespace ftxui {
+
+namespace {
+
+const float kPi = 3.14159265f;
+
+// The cells are about twice as high as wide. The radial gradients take it into
+// account to look round.
+const float kCellRatio = 2.f;
+
+// The number of pairs of colors whose ColorMap is kept.
+const size_t kCachedColorMaps = 16;
+
+Color& ColorOf(Pixel& pixel, bool background) {
+  return background ? pixel.background_color : pixel.foreground_color;
+}
+
+// The colors from |from| to |to|. The gradients are built again at every
+// frame, with the same colors, so their ColorMap are kept. They depend on the
+// colors the terminal supports too.
+std::shared_ptr<const ColorMap> GradientColorMap(Color from, Color to) {
+  struct Entry {
+    Color from;
+    Color to;
+    Terminal::Color support;
+    std::shared_ptr<const ColorMap> color_map;
+  };
+  // The last ones, from the oldest.
+  static std::mutex mutex;
+  static std::vector<Entry> entries;
+
+  const Terminal::Color support = Terminal::ColorSupport();
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const Entry& entry : entries) {
+    if (entry.from == from && entry.to == to && entry.support == support)
+      return entry.color_map;
+  }
+  if (entries.size() == kCachedColorMaps)
+    entries.erase(entries.begin());
+  entries.push_back({from, to, support,
+                     std::make_shared<ColorMap>([&](float t) {
+                       return Color::Interpolate(t, from, to);
+                     })});
+  return entries.back().color_map;
+}
+
+// Paint a gradient below the children. The colors are interpolated once into a
+// ColorMap, so a cell costs an index.
+class Gradient : public NodeDecorator {
+ public:
+  Gradient(Element child,
+           bool background,
+           bool radial,
+           float angle,
+           Color from,
+           Color to)
+      : NodeDecorator(std::move(child)),
+        background_(background),
+        radial_(radial),
+        angle_(angle),
+        from_(from),
+        to_(to) {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(background_ << 1 | radial_);
+    hash.AddFloat(angle_);
+    hash.Add(from_);
+    hash.Add(to_);
+    return HashChildren(hash);
+  }
+
+  void Render(Screen& screen) override {
+    const auto color_map = GradientColorMap(from_, to_);
+    if (radial_)
+      RenderRadial(screen, *color_map);
+    else
+      RenderLinear(screen, *color_map);
+    NodeDecorator::Render(screen);
+  }
+
+ private:
+  // The gradient goes along the direction |angle_|, in degrees, from the first
+  // corner of the box to the last one.
+  void RenderLinear(Screen& screen, const ColorMap& color_map) {
+    const float dx = std::cos(angle_ * kPi / 180.f);
+    const float dy = std::sin(angle_ * kPi / 180.f);
+    const float width = box_.x_max - box_.x_min;
+    const float height = box_.y_max - box_.y_min;
+    const float min = std::min(0.f, dx * width) + std::min(0.f, dy * height);
+    const float max = std::max(0.f, dx * width) + std::max(0.f, dy * height);
+    const float scale = max > min ? 1.f / (max - min) : 0.f;
+
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      if (row.x_min() > row.x_max())
+        continue;
+      // t grows by the same step from a cell to the next one.
+      const float step = dx * scale;
+      float t = (dx * (row.x_min() - box_.x_min) +  //
+                 dy * (y - box_.y_min) - min) *
+                scale;
+      for (int x = row.x_min(); x <= row.x_max(); ++x, t += step)
+        ColorOf(row.PixelAt(x), background_) = color_map(t);
+    }
+  }
+
+  // The gradient goes from the center of the box to its corners.
+  void RenderRadial(Screen& screen, const ColorMap& color_map) {
+    const float center_x = (box_.x_min + box_.x_max) / 2.f;
+    const float center_y = (box_.y_min + box_.y_max) / 2.f;
+    const float half_width = (box_.x_max - box_.x_min) / 2.f;
+    const float half_height = kCellRatio * (box_.y_max - box_.y_min) / 2.f;
+    const float radius =
+        std::sqrt(half_width * half_width + half_height * half_height);
+    const float scale = radius > 0.f ? 1.f / radius : 0.f;
+
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      const float dy = kCellRatio * (y - center_y);
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        const float dx = x - center_x;
+        ColorOf(row.PixelAt(x), background_) =
+            color_map(std::sqrt(dx * dx + dy * dy) * scale);
+      }
+    }
+  }
+
+  bool background_;
+  bool radial_;
+  float angle_;
+  Color from_;
+  Color to_;
+};
+
+// Mix the colors drawn by the children with a color.
+class Blend : public NodeDecorator {
+ public:
+  Blend(Element child, bool background, Color color, float alpha)
+      : NodeDecorator(std::move(child)),
+        background_(background),
+        color_(color),
+        alpha_(alpha) {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(background_);
+    hash.Add(color_);
+    hash.AddFloat(alpha_);
+    return HashChildren(hash);
+  }
+
+  void Render(Screen& screen) override {
+    NodeDecorator::Render(screen);
+
+    // Neighbor cells often share their color. It is mixed once per run.
+    Color last_input = Color::Default;
+    Color last_output = Color::Interpolate(alpha_, last_input, color_);
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        Color& color = ColorOf(row.PixelAt(x), background_);
+        if (color != last_input) {
+          last_input = color;
+          last_output = Color::Interpolate(alpha_, color, color_);
+        }
+        color = last_output;
+      }
+    }
+  }
+
+ private:
+  bool background_;
+  Color color_;
+  float alpha_;
+};
+
+Decorator MakeGradient(bool background,
+                       bool radial,
+                       float angle,
+                       Color from,
+                       Color to) {
+  return [=](Element child) -> Element {
+    return std::make_shared<Gradient>(std::move(child), background, radial,
+                                      angle, from, to);
+  };
+}
+
+Decorator MakeBlend(bool background, Color color, float alpha) {
+  return [=](Element child) -> Element {
+    return std::make_shared<Blend>(std::move(child), background, color, alpha);
+  };
+}
+
+}  // namespace
+
+/// @brief Color the foreground of an element with a linear gradient.
+/// @param angle The direction of the gradient, in degrees. 0 goes from the left
+///              to the right, 90 from the top to the bottom.
+/// @param from The color of the first corner.
+/// @param to The color of the last corner.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element title = text(L"FTXUI") | color_gradient(0, Color::Red, Color::Blue);
+/// ```
+Decorator color_gradient(float angle, Color from, Color to) {
+  return MakeGradient(false, false, angle, from, to);
+}
+
+/// @brief Color the background of an element with a linear gradient.
+/// @param angle The direction of the gradient, in degrees. 0 goes from the left
+///              to the right, 90 from the top to the bottom.
+/// @param from The color of the first corner.
+/// @param to The color of the last corner.
+/// @ingroup dom
+Decorator bgcolor_gradient(float angle, Color from, Color to) {
+  return MakeGradient(true, false, angle, from, to);
+}
+
+/// @brief Color the foreground of an element with a radial gradient.
+/// @param center The color of the center of the element.
+/// @param edge The color of its corners.
+/// @ingroup dom
+Decorator color_radial_gradient(Color center, Color edge) {
+  return MakeGradient(false, true, 0.f, center, edge);
+}
+
+/// @brief Color the background of an element with a radial gradient.
+/// @param center The color of the center of the element.
+/// @param edge The color of its corners.
+/// @ingroup dom
+Decorator bgcolor_radial_gradient(Color center, Color edge) {
+  return MakeGradient(true, true, 0.f, center, edge);
+}
+
+/// @brief Mix the foreground colors of an element with |color|.
+/// @param color The color to mix in.
+/// @param alpha The proportion of |color| [0,1].
+/// @ingroup dom
+/// @see Color::Interpolate
+///
+/// ### Example
+///
+/// ```cpp
+/// // Fade the element out, as the animation progresses.
+/// Element faded = element | color_blend(Color::Black, progress);
+/// ```
+Decorator color_blend(Color color, float alpha) {
+  return MakeBlend(false, color, alpha);
+}
+
+/// @brief Mix the background colors of an element with |color|.
+/// @param color The color to mix in.
+/// @param alpha The proportion of |color| [0,1].
+/// @ingroup dom
+/// @see Color::Interpolate
+Decorator bgcolor_blend(Color color, float alpha) {
+  return MakeBlend(true, color, alpha);
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,61 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator
+
+#include "ftxui/dom/elements.hpp"   // for text, operator|, bgcolor_gradient, color_blend, bgcolor
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+Color Gray(int value) {
+  return Color::RGB(value, value, value);
+}
+}  // namespace
+
+TEST(GradientTest, Interpolate) {
+  EXPECT_EQ(Color::Interpolate(0.f, Gray(0), Gray(255)), Gray(0));
+  EXPECT_EQ(Color::Interpolate(1.f, Gray(0), Gray(255)), Gray(255));
+  EXPECT_EQ(Color::Interpolate(0.5f, Gray(0), Gray(255)), Gray(128));
+  EXPECT_EQ(Color::Interpolate(0.2f, Color::Default, Gray(0)), Color::Default);
+  EXPECT_EQ(Color::Interpolate(0.8f, Color::Default, Gray(0)), Gray(0));
+}
+
+TEST(GradientTest, Linear) {
+  Screen screen(5, 2);
+  Render(screen, text(L"abcde") | bgcolor_gradient(0, Gray(0), Gray(255)));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Gray(0));
+  EXPECT_EQ(screen.PixelAt(4, 0).background_color, Gray(255));
+  EXPECT_EQ(screen.PixelAt(0, 0).character, L"a");
+
+  // Vertical.
+  Screen vertical(1, 3);
+  Render(vertical, vbox({text(L"a"), text(L"b"), text(L"c")}) |
+                       bgcolor_gradient(90, Gray(0), Gray(255)));
+  EXPECT_EQ(vertical.PixelAt(0, 0).background_color, Gray(0));
+  EXPECT_EQ(vertical.PixelAt(0, 2).background_color, Gray(255));
+}
+
+TEST(GradientTest, Radial) {
+  Screen screen(3, 3);
+  Render(screen, vbox({text(L"   "), text(L"   "), text(L"   ")}) |
+                     bgcolor_radial_gradient(Gray(255), Gray(0)));
+  EXPECT_EQ(screen.PixelAt(1, 1).background_color, Gray(255));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Gray(0));
+  EXPECT_EQ(screen.PixelAt(2, 2).background_color, Gray(0));
+}
+
+TEST(GradientTest, Blend) {
+  Screen screen(2, 1);
+  Render(screen, hbox({text(L"a") | bgcolor(Gray(0)), text(L"b")}) |
+                     bgcolor_blend(Gray(255), 0.5f));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Gray(128));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Gray(255));
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -6,7 +6,7 @@
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/screen/screen.hpp"    // for Screen, RowWriter
 
 namespace ftxui {
 
@@ -36,16 +36,16 @@ class Graph : public Node {
     int width = (box_.x_max - box_.x_min + 1) * 2;
     int height = (box_.y_max - box_.y_min + 1) * 2;
     auto data = graph_function_(width, height);
-    int i = 0;
-    for (int x = box_.x_min; x <= box_.x_max; ++x) {
-      int height_1 = 2 * box_.y_max - data[i++];
-      int height_2 = 2 * box_.y_max - data[i++];
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        int yy = 2 * y;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      int yy = 2 * y;
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        int i = 2 * (x - box_.x_min);
+        int height_1 = 2 * box_.y_max - data[i];
+        int height_2 = 2 * box_.y_max - data[i + 1];
         int i_1 = yy < height_1 ? 0 : yy == height_1 ? 3 : 6;
         int i_2 = yy < height_2 ? 0 : yy == height_2 ? 1 : 2;
-        wchar_t pix = charset[i_1 + i_2];
-        screen.at(x, y) = pix;
+        row.at(x) = charset[i_1 + i_2];
       }
     }
   }
@@ -0,0 +1,157 @@
+#include <stddef.h>   // for size_t
+#include <algorithm>  // for max
+#include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
+#include "ftxui/dom/elements.hpp"     // for Element, Elements, gridbox
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/parallel.hpp"     // for Layout, RenderDisjoint, SearchableLayout
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+class GridBox : public Node {
+ public:
+  GridBox(std::vector<Elements> lines) : Node() {
+    dimy_ = lines.size();
+    for (const auto& line : lines)
+      dimx_ = std::max(dimx_, int(line.size()));
+
+    // The cells are stored row by row. Missing cells from shorter lines are
+    // replaced by empty elements.
+    children_.reserve(dimx_ * dimy_);
+    for (auto& line : lines) {
+      for (auto& cell : line)
+        children_.push_back(std::move(cell));
+      for (size_t x = line.size(); x < size_t(dimx_); ++x)
+        children_.push_back(std::make_shared<Node>());
+    }
+  }
+  ~GridBox() override {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(dimx_);
+    return HashChildren(hash);
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 0;
+    requirement_.min_y = 0;
+    requirement_.flex_grow_x = 0;
+    requirement_.flex_grow_y = 0;
+    requirement_.flex_shrink_x = 0;
+    requirement_.flex_shrink_y = 0;
+    requirement_.selection = Requirement::NORMAL;
+
+    columns_.assign(dimx_, {});
+    rows_.assign(dimy_, {});
+    int selected_x = 0;
+    int selected_y = 0;
+    for (int y = 0; y < dimy_; ++y) {
+      for (int x = 0; x < dimx_; ++x) {
+        Node* cell = children_[y * dimx_ + x].get();
+        cell->ComputeRequirement();
+        const Requirement& r = cell->requirement();
+
+        box_helper::Element& column = columns_[x];
+        column.min_size = std::max(column.min_size, r.min_x);
+        column.flex_grow = std::max(column.flex_grow, r.flex_grow_x);
+        column.flex_shrink = std::max(column.flex_shrink, r.flex_shrink_x);
+
+        box_helper::Element& row = rows_[y];
+        row.min_size = std::max(row.min_size, r.min_y);
+        row.flex_grow = std::max(row.flex_grow, r.flex_grow_y);
+        row.flex_shrink = std::max(row.flex_shrink, r.flex_shrink_y);
+
+        if (requirement_.selection < r.selection) {
+          requirement_.selection = r.selection;
+          requirement_.selected_box = r.selected_box;
+          selected_x = x;
+          selected_y = y;
+        }
+      }
+    }
+
+    // Offset the selected box by the size of the tracks before it.
+    for (int x = 0; x < dimx_; ++x) {
+      if (x == selected_x) {
+        requirement_.selected_box.x_min += requirement_.min_x;
+        requirement_.selected_box.x_max += requirement_.min_x;
+      }
+      requirement_.min_x += columns_[x].min_size;
+    }
+    for (int y = 0; y < dimy_; ++y) {
+      if (y == selected_y) {
+        requirement_.selected_box.y_min += requirement_.min_y;
+        requirement_.selected_box.y_max += requirement_.min_y;
+      }
+      requirement_.min_y += rows_[y].min_size;
+    }
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+
+    box_helper::Compute(&columns_, box.x_max - box.x_min + 1);
+    box_helper::Compute(&rows_, box.y_max - box.y_min + 1);
+
+    Box cell_box;
+    cell_box.y_min = box.y_min;
+    for (int y = 0; y < dimy_; ++y) {
+      cell_box.y_max = cell_box.y_min + rows_[y].size - 1;
+      cell_box.x_min = box.x_min;
+      for (int x = 0; x < dimx_; ++x) {
+        cell_box.x_max = cell_box.x_min + columns_[x].size - 1;
+        children_[y * dimx_ + x]->SetBox(cell_box);
+        cell_box.x_min = cell_box.x_max + 1;
+      }
+      cell_box.y_min = cell_box.y_max + 1;
+    }
+    layout_ = SearchableLayout(children_, Layout::Vertical);
+  }
+
+  void Render(Screen& screen) override {
+    RenderDisjoint(screen, children_, layout_);
+  }
+
+  bool CullsByStencil() const override { return true; }
+
+ private:
+  int dimx_ = 0;
+  int dimy_ = 0;
+  std::vector<box_helper::Element> columns_;
+  std::vector<box_helper::Element> rows_;
+  Layout layout_ = Layout::Any;
+};
+
+/// @brief A container displaying a grid of elements.
+/// @param lines A list of lines, each being a list of elements.
+/// @return The container.
+/// @ingroup dom
+///
+/// Every cell of a column gets the same width, and every cell of a row the
+/// same height. The size of all the columns and all the rows is solved at
+/// once, which is cheaper than nesting vbox inside hbox.
+///
+/// #### Example
+///
+/// ```cpp
+/// gridbox({
+///   {text(L"north-west"), text(L"north"), text(L"north-east")},
+///   {text(L"west"), text(L"center") | flex, text(L"east")},
+///   {text(L"south-west"), text(L"south"), text(L"south-east")},
+/// });
+/// ```
+Element gridbox(std::vector<Elements> lines) {
+  return std::make_shared<GridBox>(std::move(lines));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,87 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator, basic_string, string
+#include <vector>                   // for vector
+
+#include "ftxui/dom/elements.hpp"   // for text, operator|, Element, flex
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/box.hpp"     // for ftxui
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(GridboxTest, Basic) {
+  auto root = gridbox({
+      {text(L"a"), text(L"bb"), text(L"c")},
+      {text(L"ddd"), text(L"e"), text(L"f")},
+  });
+
+  Screen screen(6, 2);
+  Render(screen, root);
+  EXPECT_EQ(
+      "a  bbc\r\n"
+      "ddde f",
+      screen.ToString());
+}
+
+TEST(GridboxTest, MissingCells) {
+  auto root = gridbox({
+      {text(L"a"), text(L"b"), text(L"c")},
+      {text(L"d")},
+      {},
+      {text(L"e"), text(L"f")},
+  });
+
+  Screen screen(4, 3);
+  Render(screen, root);
+  EXPECT_EQ(
+      "abc \r\n"
+      "d   \r\n"
+      "ef  ",
+      screen.ToString());
+}
+
+TEST(GridboxTest, FlexColumn) {
+  auto root = gridbox({
+      {text(L"a"), text(L"b") | flex, text(L"c")},
+      {text(L"d"), text(L"e"), text(L"f")},
+  });
+
+  std::vector<std::string> expectations = {
+      "\r\n",                //
+      "a\r\nd",              //
+      "ac\r\ndf",            //
+      "abc\r\ndef",          //
+      "ab c\r\nde f",        //
+      "ab  c\r\nde  f",      //
+      "ab   c\r\nde   f",    //
+  };
+  for (int i = 0; i < int(expectations.size()); ++i) {
+    Screen screen(i, 2);
+    Render(screen, root);
+    EXPECT_EQ(expectations[i], screen.ToString());
+  }
+}
+
+TEST(GridboxTest, FlexRow) {
+  auto root = gridbox({
+      {text(L"a"), text(L"b")},
+      {text(L"c") | flex, text(L"d")},
+      {text(L"e"), text(L"f")},
+  });
+
+  Screen screen(2, 5);
+  Render(screen, root);
+  EXPECT_EQ(
+      "ab\r\n"
+      "cd\r\n"
+      "  \r\n"
+      "  \r\n"
+      "ef",
+      screen.ToString());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -5,8 +5,10 @@
 
 #include "ftxui/dom/elements.hpp"     // for Element, Elements, hbox
 #include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/parallel.hpp"     // for Layout, RenderDisjoint, SearchableLayout
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
 
 namespace ftxui {
 
@@ -15,6 +17,8 @@ class HBox : public Node {
   HBox(Elements children) : Node(std::move(children)) {}
   ~HBox() {}
 
+  bool Hash(StructuralHash& hash) override { return HashChildren(hash); }
+
   void ComputeRequirement() override {
     requirement_.min_x = 0;
     requirement_.min_y = 0;
@@ -63,8 +67,16 @@ class HBox : public Node {
     else
       SetBoxShrinkHard(box, extra_space + flex_shrink_size,
                        size - flex_shrink_size);
+
+    layout_ = SearchableLayout(children_, Layout::Horizontal);
+  }
+
+  void Render(Screen& screen) override {
+    RenderDisjoint(screen, children_, layout_);
   }
 
+  bool CullsByStencil() const override { return true; }
+
   void SetBoxGrow(Box box, int extra_space, int flex_grow_sum) {
     int x = box.x_min;
     for (auto& child : children_) {
@@ -127,6 +139,9 @@ class HBox : public Node {
       x = child_box.x_max + 1;
     }
   }
+
+ private:
+  Layout layout_ = Layout::Any;
 };
 
 /// @brief A container displaying elements horizontally one by one.
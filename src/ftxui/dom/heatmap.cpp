@@ -0,0 +1,122 @@
+#include <algorithm>  // for max, min
+#include <memory>     // for make_shared
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"         // for Element, heatmap, heatmap_half_block
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/requirement.hpp"      // for Requirement
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/color.hpp"         // for Color
+#include "ftxui/screen/color_map.hpp"     // for ColorMap
+#include "ftxui/screen/screen.hpp"        // for Pixel, Screen, RowWriter
+
+namespace ftxui {
+
+namespace {
+
+class Heatmap : public Node {
+ public:
+  Heatmap(std::vector<std::vector<float>> values,
+          ColorMap color_map,
+          bool half_block)
+      : values_(std::move(values)),
+        color_map_(std::move(color_map)),
+        half_block_(half_block) {
+    for (const auto& line : values_)
+      width_ = std::max(width_, int(line.size()));
+  }
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(half_block_);
+    for (const Color& color : color_map_.colors())
+      hash.Add(color);
+    for (const auto& line : values_) {
+      hash.Add(line.size());
+      for (float value : line)
+        hash.AddFloat(value);
+    }
+    return HashChildren(hash);
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = width_;
+    requirement_.min_y = half_block_ ? (int(values_.size()) + 1) / 2  //
+                                     : int(values_.size());
+  }
+
+  void Render(Screen& screen) override {
+    const int lines_per_row = half_block_ ? 2 : 1;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      const size_t line = size_t(y - box_.y_min) * lines_per_row;
+      if (line >= values_.size())
+        return;
+      const std::vector<float>& top = values_[line];
+      const std::vector<float>* bottom =
+          half_block_ && line + 1 < values_.size() ? &values_[line + 1]
+                                                   : nullptr;
+
+      RowWriter row(screen, y, box_.x_min,
+                    std::min(box_.x_max, box_.x_min + int(top.size()) - 1));
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        const size_t i = x - box_.x_min;
+        Pixel& pixel = row.PixelAt(x);
+        if (!half_block_) {
+          pixel.character = L' ';
+          pixel.background_color = color_map_(top[i]);
+          continue;
+        }
+        // The upper half is the foreground, the lower half the background.
+        pixel.character = L'▀';
+        pixel.foreground_color = color_map_(top[i]);
+        pixel.background_color = bottom && i < bottom->size()
+                                     ? color_map_((*bottom)[i])
+                                     : Color::Default;
+      }
+    }
+  }
+
+ private:
+  std::vector<std::vector<float>> values_;
+  ColorMap color_map_;
+  bool half_block_;
+  int width_ = 0;
+};
+
+}  // namespace
+
+/// @brief Draw a matrix of values, one per cell, colored by |color_map|.
+/// @param values The lines of values, in [0, 1].
+/// @param color_map The color of the values.
+/// @ingroup dom
+/// @see ColorMap
+///
+/// ### Example
+///
+/// ```cpp
+/// ColorMap red([](float v) { return Color::RGB(255 * v, 0, 0); });
+/// Element document = heatmap({{0.f, 0.5f}, {0.5f, 1.f}}, red);
+/// ```
+Element heatmap(std::vector<std::vector<float>> values, ColorMap color_map) {
+  return std::make_shared<Heatmap>(std::move(values), std::move(color_map),
+                                   false);
+}
+
+/// @brief Same as heatmap(), with two lines of values per row of cells, drawn
+/// with half blocks.
+/// @param values The lines of values, in [0, 1].
+/// @param color_map The color of the values.
+/// @ingroup dom
+/// @see ColorMap
+Element heatmap_half_block(std::vector<std::vector<float>> values,
+                           ColorMap color_map) {
+  return std::make_shared<Heatmap>(std::move(values), std::move(color_map),
+                                   true);
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
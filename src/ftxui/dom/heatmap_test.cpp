@@ -0,0 +1,72 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <cmath>                    // for NAN
+#include <string>                   // for allocator, wstring
+#include <vector>                   // for vector
+
+#include "ftxui/dom/elements.hpp"      // for heatmap, heatmap_half_block
+#include "ftxui/dom/node.hpp"          // for Render
+#include "ftxui/screen/color.hpp"      // for Color
+#include "ftxui/screen/color_map.hpp"  // for ColorMap
+#include "ftxui/screen/screen.hpp"     // for Screen, Pixel
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+Color Gray(float value) {
+  return Color::RGB(255 * value, 255 * value, 255 * value);
+}
+}  // namespace
+
+TEST(HeatmapTest, ColorMap) {
+  ColorMap map(Gray);
+  EXPECT_EQ(map(0.f), Gray(0.f));
+  EXPECT_EQ(map(1.f), Gray(1.f));
+  EXPECT_EQ(map(2.f), Gray(1.f));
+  EXPECT_EQ(map(-1.f), Gray(0.f));
+  EXPECT_EQ(map(NAN), Color::Default);
+}
+
+TEST(HeatmapTest, Basic) {
+  Screen screen(3, 3);
+  Render(screen, heatmap({{0.f, 1.f}, {1.f}}, ColorMap(Gray)));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Gray(0.f));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Gray(1.f));
+  EXPECT_EQ(screen.PixelAt(0, 1).background_color, Gray(1.f));
+  EXPECT_EQ(screen.PixelAt(1, 1).background_color, Color::Default);
+  EXPECT_EQ(screen.PixelAt(0, 2).background_color, Color::Default);
+}
+
+// A heatmap narrower than its values doesn't draw over what follows it.
+TEST(HeatmapTest, Shrunk) {
+  std::vector<float> values(10, 1.f);
+  Screen screen(8, 3);
+  Render(screen, hbox({
+                     heatmap({values}, ColorMap(Gray)) |
+                         size(WIDTH, EQUAL, 3) | border,
+                     text(L"abc"),
+                 }));
+  EXPECT_EQ(screen.PixelAt(3, 1).background_color, Gray(1.f));
+  EXPECT_EQ(screen.PixelAt(4, 1).background_color, Color::Default);
+  EXPECT_EQ(screen.PixelAt(5, 0).character, L"a");
+  for (int x = 5; x < 8; ++x)
+    EXPECT_EQ(screen.PixelAt(x, 0).background_color, Color::Default);
+}
+
+TEST(HeatmapTest, HalfBlock) {
+  Screen screen(2, 2);
+  Render(screen, heatmap_half_block({{0.f, 1.f}, {1.f, 0.f}, {1.f, 1.f}},
+                                    ColorMap(Gray)));
+  EXPECT_EQ(screen.PixelAt(0, 0).character, L"▀");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Gray(0.f));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Gray(1.f));
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Gray(1.f));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, Gray(0.f));
+  EXPECT_EQ(screen.PixelAt(0, 1).foreground_color, Gray(1.f));
+  EXPECT_EQ(screen.PixelAt(0, 1).background_color, Color::Default);
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
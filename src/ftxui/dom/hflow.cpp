@@ -15,6 +15,8 @@ class HFlow : public Node {
   HFlow(Elements children) : Node(std::move(children)) {}
   ~HFlow() {}
 
+  bool Hash(StructuralHash& hash) override { return HashChildren(hash); }
+
   void ComputeRequirement() override {
     requirement_.min_x = 1;
     requirement_.min_y = 1;
@@ -0,0 +1,376 @@
+#include <stddef.h>   // for size_t
+#include <stdint.h>   // for uint8_t, int64_t, uint64_t
+#include <algorithm>  // for min, max
+#include <memory>     // for make_shared, shared_ptr
+#include <mutex>      // for mutex, lock_guard
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"         // for Element, image
+#include "ftxui/dom/image.hpp"            // for Image, ImageOption
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/requirement.hpp"      // for Requirement
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/color.hpp"         // for Color
+#include "ftxui/screen/color_info.hpp"  // for ColorInfo, ClosestPalette256, GetColorInfo
+#include "ftxui/screen/screen.hpp"    // for Pixel, Screen, RowWriter
+#include "ftxui/screen/terminal.hpp"  // for Terminal
+
+namespace ftxui {
+
+namespace {
+
+// The number of box sizes whose drawing is kept.
+const size_t kCachedSizes = 4;
+
+struct RGB {
+  int red;
+  int green;
+  int blue;
+};
+
+struct Cell {
+  wchar_t character;
+  Color foreground;
+  Color background;
+};
+
+uint8_t Clamp(int value) {
+  return std::max(0, std::min(255, value));
+}
+
+Color ToColor(const RGB& c) {
+  return Color::RGB(Clamp(c.red), Clamp(c.green), Clamp(c.blue));
+}
+
+// The color the terminal displays for |c|.
+RGB Displayed(const RGB& c, Terminal::Color support) {
+  ColorInfo info = GetColorInfo(
+      ClosestPalette256(Clamp(c.red), Clamp(c.green), Clamp(c.blue)));
+  if (support != Terminal::Color::Palette256)
+    info = GetColorInfo(Color::Palette16(info.index_16));
+  return {info.red, info.green, info.blue};
+}
+
+// Indexed by the quadrants drawn with the foreground color: 1 for the top
+// left, 2 for the top right, 4 for the bottom left, 8 for the bottom right.
+const wchar_t quadrant_charset[] = L" ▘▝▀▖▌▞▛▗▚▐▜▄▙▟█";
+
+}  // namespace
+
+struct Image::Data {
+  std::vector<uint8_t> rgb;
+  int width;
+  int height;
+  ImageOption option;
+
+  // The image drawn into |dimx| x |dimy| cells, with the colors |support|.
+  struct Drawing {
+    int box_width;
+    int box_height;
+    Terminal::Color support;
+    int dimx;
+    int dimy;
+    std::vector<Cell> cells;
+  };
+
+  // The last drawings, from the oldest.
+  std::mutex mutex;
+  std::vector<std::shared_ptr<const Drawing>> drawings;
+
+  std::shared_ptr<const Drawing> Draw(int box_width, int box_height) {
+    const Terminal::Color support = Terminal::ColorSupport();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& drawing : drawings) {
+      if (drawing->box_width == box_width &&
+          drawing->box_height == box_height && drawing->support == support) {
+        return drawing;
+      }
+    }
+    if (drawings.size() == kCachedSizes)
+      drawings.erase(drawings.begin());
+    drawings.push_back(Build(box_width, box_height, support));
+    return drawings.back();
+  }
+
+  std::shared_ptr<const Drawing> Build(int box_width,
+                                       int box_height,
+                                       Terminal::Color support) const {
+    auto drawing = std::make_shared<Drawing>();
+    drawing->box_width = box_width;
+    drawing->box_height = box_height;
+    drawing->support = support;
+    drawing->dimx = 0;
+    drawing->dimy = 0;
+    if (width <= 0 || height <= 0 || box_width <= 0 || box_height <= 0)
+      return drawing;
+
+    // Fit the image into the pixels of the box, keeping its aspect ratio.
+    const int pixels_per_cell_x = option.mode == ImageOption::Quadrant ? 2 : 1;
+    const int grid_width = box_width * pixels_per_cell_x;
+    const int grid_height = box_height * 2;
+    const float scale =
+        std::min(float(grid_width) / width, float(grid_height) / height);
+    const int dimx =
+        std::max(1, std::min(grid_width, int(width * scale + 0.5f)));
+    const int dimy =
+        std::max(1, std::min(grid_height, int(height * scale + 0.5f)));
+
+    std::vector<RGB> pixels = Scale(dimx, dimy);
+    Dither(&pixels, dimx, dimy, support);
+
+    drawing->dimx = (dimx + pixels_per_cell_x - 1) / pixels_per_cell_x;
+    drawing->dimy = (dimy + 1) / 2;
+    drawing->cells.reserve(drawing->dimx * drawing->dimy);
+    auto pixel = [&](int x, int y) -> const RGB& {
+      return pixels[std::min(y, dimy - 1) * dimx + std::min(x, dimx - 1)];
+    };
+    for (int y = 0; y < drawing->dimy; ++y) {
+      for (int x = 0; x < drawing->dimx; ++x) {
+        if (option.mode == ImageOption::HalfBlock) {
+          drawing->cells.push_back({L'▀', ToColor(pixel(x, 2 * y)),
+                                    ToColor(pixel(x, 2 * y + 1))});
+        } else {
+          const RGB quadrants[4] = {
+              pixel(2 * x, 2 * y),
+              pixel(2 * x + 1, 2 * y),
+              pixel(2 * x, 2 * y + 1),
+              pixel(2 * x + 1, 2 * y + 1),
+          };
+          drawing->cells.push_back(Quadrants(quadrants));
+        }
+      }
+    }
+    return drawing;
+  }
+
+  // Scale the image to |dimx| x |dimy| pixels. Every pixel is the average of
+  // the ones it covers, one axis after the other.
+  std::vector<RGB> Scale(int dimx, int dimy) const {
+    auto range = [](int i, int from, int to, int* begin, int* end) {
+      *begin = int(int64_t(i) * from / to);
+      *end = std::max(*begin + 1, int(int64_t(i + 1) * from / to));
+    };
+
+    std::vector<RGB> horizontal(size_t(height) * dimx);
+    for (int x = 0; x < dimx; ++x) {
+      int begin, end;
+      range(x, width, dimx, &begin, &end);
+      for (int y = 0; y < height; ++y) {
+        const uint8_t* source = &rgb[(size_t(y) * width + begin) * 3];
+        RGB sum = {0, 0, 0};
+        for (int i = begin; i < end; ++i, source += 3) {
+          sum.red += source[0];
+          sum.green += source[1];
+          sum.blue += source[2];
+        }
+        const int count = end - begin;
+        horizontal[size_t(y) * dimx + x] = {sum.red / count, sum.green / count,
+                                            sum.blue / count};
+      }
+    }
+
+    std::vector<RGB> scaled(size_t(dimy) * dimx);
+    for (int y = 0; y < dimy; ++y) {
+      int begin, end;
+      range(y, height, dimy, &begin, &end);
+      const int count = end - begin;
+      for (int x = 0; x < dimx; ++x) {
+        RGB sum = {0, 0, 0};
+        for (int i = begin; i < end; ++i) {
+          const RGB& source = horizontal[size_t(i) * dimx + x];
+          sum.red += source.red;
+          sum.green += source.green;
+          sum.blue += source.blue;
+        }
+        scaled[size_t(y) * dimx + x] = {sum.red / count, sum.green / count,
+                                         sum.blue / count};
+      }
+    }
+    return scaled;
+  }
+
+  // Replace the pixels by colors of the palette of the terminal, spreading
+  // the difference.
+  void Dither(std::vector<RGB>* pixels,
+              int dimx,
+              int dimy,
+              Terminal::Color support) const {
+    if (option.dithering == ImageOption::None ||
+        support == Terminal::Color::TrueColor) {
+      return;
+    }
+
+    if (option.dithering == ImageOption::Ordered) {
+      static const int bayer[4][4] = {
+          {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+      // About the distance between two colors of the palette.
+      const int spread = support == Terminal::Color::Palette256 ? 48 : 128;
+      for (int y = 0; y < dimy; ++y) {
+        for (int x = 0; x < dimx; ++x) {
+          RGB& pixel = (*pixels)[size_t(y) * dimx + x];
+          const int offset = (2 * bayer[y % 4][x % 4] - 15) * spread / 32;
+          pixel = Displayed({pixel.red + offset, pixel.green + offset,
+                             pixel.blue + offset},
+                            support);
+        }
+      }
+      return;
+    }
+
+    // Floyd-Steinberg.
+    auto spread = [&](int x, int y, const RGB& error, int weight) {
+      if (x < 0 || x >= dimx || y >= dimy)
+        return;
+      RGB& pixel = (*pixels)[size_t(y) * dimx + x];
+      pixel.red += error.red * weight / 16;
+      pixel.green += error.green * weight / 16;
+      pixel.blue += error.blue * weight / 16;
+    };
+    for (int y = 0; y < dimy; ++y) {
+      for (int x = 0; x < dimx; ++x) {
+        RGB& pixel = (*pixels)[size_t(y) * dimx + x];
+        const RGB displayed = Displayed(pixel, support);
+        const RGB error = {pixel.red - displayed.red,
+                           pixel.green - displayed.green,
+                           pixel.blue - displayed.blue};
+        pixel = displayed;
+        spread(x + 1, y, error, 7);
+        spread(x - 1, y + 1, error, 3);
+        spread(x, y + 1, error, 5);
+        spread(x + 1, y + 1, error, 1);
+      }
+    }
+  }
+
+  // Approximate 2x2 pixels by a quadrant character and two colors. Every way
+  // of splitting them into two groups is tried.
+  static Cell Quadrants(const RGB (&pixels)[4]) {
+    int best_mask = 0;
+    int best_error = -1;
+    RGB best_colors[2] = {{0, 0, 0}, {0, 0, 0}};
+    // The bottom right pixel is always in the background group, the other
+    // masks are the same splits with the groups swapped.
+    for (int mask = 0; mask < 8; ++mask) {
+      RGB sum[2] = {{0, 0, 0}, {0, 0, 0}};
+      int count[2] = {0, 0};
+      for (int i = 0; i < 4; ++i) {
+        const int group = (mask >> i) & 1;
+        sum[group].red += pixels[i].red;
+        sum[group].green += pixels[i].green;
+        sum[group].blue += pixels[i].blue;
+        count[group]++;
+      }
+      RGB mean[2];
+      for (int group = 0; group < 2; ++group) {
+        const int n = std::max(1, count[group]);
+        mean[group] = {sum[group].red / n, sum[group].green / n,
+                       sum[group].blue / n};
+      }
+      int error = 0;
+      for (int i = 0; i < 4; ++i) {
+        const RGB& m = mean[(mask >> i) & 1];
+        const int dr = pixels[i].red - m.red;
+        const int dg = pixels[i].green - m.green;
+        const int db = pixels[i].blue - m.blue;
+        error += dr * dr + dg * dg + db * db;
+      }
+      if (best_error < 0 || error < best_error) {
+        best_error = error;
+        best_mask = mask;
+        best_colors[0] = mean[0];
+        best_colors[1] = mean[1];
+      }
+    }
+    return {quadrant_charset[best_mask], ToColor(best_colors[1]),
+            ToColor(best_colors[0])};
+  }
+};
+
+Image::Image(std::vector<uint8_t> rgb,
+             int width,
+             int height,
+             ImageOption option)
+    : data_(std::make_shared<Data>()) {
+  data_->rgb = std::move(rgb);
+  data_->width = width;
+  data_->height = height;
+  data_->option = option;
+  if (data_->rgb.size() < size_t(std::max(0, width * height)) * 3)
+    data_->width = data_->height = 0;
+}
+
+int Image::width() const {
+  return data_->width;
+}
+
+int Image::height() const {
+  return data_->height;
+}
+
+const ImageOption& Image::option() const {
+  return data_->option;
+}
+
+namespace {
+
+class ImageNode : public Node {
+ public:
+  ImageNode(Image image) : image_(std::move(image)) {}
+
+  // The pixels of an Image never change. Their colors depend on the ones the
+  // terminal supports.
+  bool Hash(StructuralHash& hash) override {
+    hash.AddPointer(image_.data().get());
+    hash.Add(uint64_t(Terminal::ColorSupport()));
+    return HashChildren(hash);
+  }
+
+  void ComputeRequirement() override {
+    const int pixels_per_cell_x =
+        image_.option().mode == ImageOption::Quadrant ? 2 : 1;
+    requirement_.min_x =
+        (image_.width() + pixels_per_cell_x - 1) / pixels_per_cell_x;
+    requirement_.min_y = (image_.height() + 1) / 2;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    auto drawing = image_.data()->Draw(box_.x_max - box_.x_min + 1,
+                                       box_.y_max - box_.y_min + 1);
+    for (int y = 0; y < drawing->dimy; ++y) {
+      RowWriter row(screen, box_.y_min + y, box_.x_min,
+                    box_.x_min + drawing->dimx - 1);
+      const Cell* cells = &drawing->cells[size_t(y) * drawing->dimx];
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        const Cell& cell = cells[x - box_.x_min];
+        Pixel& pixel = row.PixelAt(x);
+        pixel.character = cell.character;
+        pixel.foreground_color = cell.foreground;
+        pixel.background_color = cell.background;
+      }
+    }
+  }
+
+ private:
+  Image image_;
+};
+
+}  // namespace
+
+/// @brief Display an RGB image, scaled to fit the box of the element.
+/// @param image The image. Keep it to draw it at the next frames, its drawing
+///              is cached.
+/// @ingroup dom
+/// @see Image
+Element image(Image image) {
+  return std::make_shared<ImageNode>(std::move(image));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,105 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <stdint.h>                 // for uint8_t
+#include <set>                      // for set
+#include <string>                   // for allocator, wstring
+#include <vector>                   // for vector
+
+#include "ftxui/dom/elements.hpp"     // for image
+#include "ftxui/dom/image.hpp"        // for Image, ImageOption
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/screen/terminal.hpp"  // for Terminal
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// A 2x2 image: red, green on the first line, blue, white on the second one.
+std::vector<uint8_t> Square() {
+  return {255, 0, 0, 0, 255, 0, 0, 0, 255, 255, 255, 255};
+}
+
+}  // namespace
+
+TEST(ImageTest, HalfBlock) {
+  Screen screen(2, 1);
+  Render(screen, image(Image(Square(), 2, 2)));
+  EXPECT_EQ(screen.PixelAt(0, 0).character, L"▀");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::RGB(255, 0, 0));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color::RGB(0, 0, 255));
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Color::RGB(0, 255, 0));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color,
+            Color::RGB(255, 255, 255));
+}
+
+TEST(ImageTest, Quadrant) {
+  ImageOption option;
+  option.mode = ImageOption::Quadrant;
+  std::vector<uint8_t> rgb = {255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+  Screen screen(1, 1);
+  Render(screen, image(Image(rgb, 2, 2, option)));
+  EXPECT_EQ(screen.PixelAt(0, 0).character, L"▘");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::RGB(255, 0, 0));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, Color::RGB(0, 0, 0));
+}
+
+TEST(ImageTest, Scaled) {
+  // A 4x4 image, with a red left half.
+  std::vector<uint8_t> rgb;
+  for (int y = 0; y < 4; ++y) {
+    for (int x = 0; x < 4; ++x) {
+      rgb.insert(rgb.end(), {uint8_t(x < 2 ? 255 : 0), 0, 0});
+    }
+  }
+
+  // Fit into 2x2 pixels, on the first row.
+  Screen screen(2, 2);
+  Render(screen, image(Image(rgb, 4, 4)));
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::RGB(255, 0, 0));
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Color::RGB(0, 0, 0));
+  EXPECT_EQ(screen.PixelAt(0, 1).character, L" ");
+}
+
+TEST(ImageTest, Cached) {
+  Image square(Square(), 2, 2);
+  Screen screen(2, 1);
+  Render(screen, image(square));
+  std::string first = screen.ToString();
+  screen.Clear();
+  Render(screen, image(square));
+  EXPECT_EQ(first, screen.ToString());
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, Color::RGB(0, 255, 0));
+}
+
+TEST(ImageTest, Dithering) {
+  if (Terminal::ColorSupport() == Terminal::Color::TrueColor)
+    return;
+
+  // A flat blue, missing from the palette, is approximated by a mix of colors.
+  std::vector<uint8_t> rgb;
+  for (int i = 0; i < 8 * 8; ++i)
+    rgb.insert(rgb.end(), {0, 0, 60});
+  for (auto dithering : {ImageOption::Ordered, ImageOption::FloydSteinberg}) {
+    ImageOption option;
+    option.dithering = dithering;
+    Screen screen(8, 4);
+    Render(screen, image(Image(rgb, 8, 8, option)));
+
+    std::set<std::wstring> colors;
+    for (int y = 0; y < 4; ++y) {
+      for (int x = 0; x < 8; ++x) {
+        colors.insert(screen.PixelAt(x, y).foreground_color.Print(false));
+        colors.insert(screen.PixelAt(x, y).background_color.Print(true));
+      }
+    }
+    EXPECT_GT(colors.size(), 2u);
+  }
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,13 +1,58 @@
+#include <algorithm>  // for max, min
+#include <ostream>    // for operator<<, ostream
+#include <typeinfo>   // for type_info
 #include <utility>
 
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/profiled_node.hpp"
+#include "ftxui/dom/sub_screen.hpp"  // for SubScreen
+#include "ftxui/screen/profiler.hpp"
 #include "ftxui/screen/screen.hpp"
 
 namespace ftxui {
 
 using ftxui::Screen;
 
+namespace {
+
+// The number of lines drawn before and after a band. The shader merges the
+// borders of a line with the lines around, those must be drawn too.
+const int kBandContext = 2;
+
+// Measure a phase, and the part of it spent in the root node.
+class PhaseScope {
+ public:
+#if defined(FTXUI_ENABLE_PROFILING)
+  PhaseScope(profiler::Phase phase, Node& root)
+      : phase_(phase), root_(phase, &typeid(root)) {}
+
+ private:
+  profiler::Scope phase_;
+  profiler::Scope root_;
+#else
+  PhaseScope(profiler::Phase, Node&) {}
+#endif
+};
+
+// Measure the calls to the descendants of a node, while alive.
+class Instrumentation {
+ public:
+#if defined(FTXUI_ENABLE_PROFILING)
+  Instrumentation(Node* node) : instrumentation_(node) {}
+
+ private:
+  ProfiledNode::Instrumentation instrumentation_;
+#else
+  Instrumentation(Node*) {}
+#endif
+};
+
+}  // namespace
+
 Node::Node() {}
+Node::Node(Element child) {
+  children_.push_back(std::move(child));
+}
 Node::Node(Elements children) : children_(std::move(children)) {}
 Node::~Node() {}
 
@@ -22,6 +67,7 @@ void Node::ComputeRequirement() {
 /// @ingroup dom
 void Node::SetBox(Box box) {
   box_ = box;
+  box_known_ = true;
 }
 
 /// @brief Display an element on a ftxui::Screen.
@@ -31,6 +77,27 @@ void Node::Render(Screen& screen) {
     child->Render(screen);
 }
 
+/// @brief Add what an element displays to |hash|.
+/// @return false when the element can't be hashed.
+/// @ingroup dom
+bool Node::Hash(StructuralHash& hash) {
+  // A bare Node, e.g. an empty cell of a gridbox, displays only its children.
+  // Its subclasses may display anything.
+  if (typeid(*this) != typeid(Node))
+    return false;
+  return HashChildren(hash);
+}
+
+bool Node::HashChildren(StructuralHash& hash) {
+  hash.AddPointer(&typeid(*this));
+  hash.Add(children_.size());
+  for (auto& child : children_) {
+    if (!child->Hash(hash))
+      return false;
+  }
+  return true;
+}
+
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, const Element& element) {
@@ -40,8 +107,29 @@ void Render(Screen& screen, const Element& element) {
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, Node* node) {
+  Instrumentation instrumentation(node);
+
   // Step 1: Find what dimension this elements wants to be.
-  node->ComputeRequirement();
+  {
+    PhaseScope scope(profiler::Phase::ComputeRequirement, *node);
+    node->ComputeRequirement();
+  }
+
+  RenderMeasured(screen, node);
+}
+
+/// @brief Display an element on a ftxui::Screen, reusing the requirement
+/// already computed, for instance by Dimension::Fit to size the screen.
+/// @ingroup dom
+void RenderMeasured(Screen& screen, const Element& element) {
+  RenderMeasured(screen, element.get());
+}
+
+/// @brief Display an element on a ftxui::Screen, reusing the requirement
+/// already computed, for instance by Dimension::Fit to size the screen.
+/// @ingroup dom
+void RenderMeasured(Screen& screen, Node* node) {
+  Instrumentation instrumentation(node);
 
   Box box;
   box.x_min = 0;
@@ -50,16 +138,75 @@ void Render(Screen& screen, Node* node) {
   box.y_max = screen.dimy() - 1;
 
   // Step 2: Assign a dimension to the element.
-  node->SetBox(box);
+  {
+    PhaseScope scope(profiler::Phase::SetBox, *node);
+    node->SetBox(box);
+  }
   screen.stencil = box;
 
   // Step 3: Draw the element.
-  node->Render(screen);
+  {
+    PhaseScope scope(profiler::Phase::Render, *node);
+    node->Render(screen);
+  }
 
   // Step 4: Apply shaders
   screen.ApplyShader();
 }
 
+/// @brief Print an element, possibly taller than what a ftxui::Screen could
+/// hold. Only |band_height| lines are drawn at a time.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Elements lines;
+/// for (auto& entry : log)
+///   lines.push_back(text(entry));
+/// RenderStreaming(std::cout, vbox(std::move(lines)) | border, 80);
+/// std::cout << std::endl;
+/// ```
+void RenderStreaming(std::ostream& out,
+                     const Element& element,
+                     int width,
+                     int band_height) {
+  Node* node = element.get();
+  Instrumentation instrumentation(node);
+  band_height = std::max(band_height, 1);
+
+  {
+    PhaseScope scope(profiler::Phase::ComputeRequirement, *node);
+    node->ComputeRequirement();
+  }
+
+  const int height = node->requirement().min_y;
+  {
+    PhaseScope scope(profiler::Phase::SetBox, *node);
+    node->SetBox(Box{0, width - 1, 0, height - 1});
+  }
+
+  for (int y = 0; y < height; y += band_height) {
+    Box band = {0, width - 1, y, std::min(y + band_height, height) - 1};
+    Box drawn = band;
+    drawn.y_min = std::max(band.y_min - kBandContext, 0);
+    drawn.y_max = std::min(band.y_max + kBandContext, height - 1);
+
+    SubScreen screen(drawn);
+    {
+      PhaseScope scope(profiler::Phase::Render, *node);
+      node->Render(screen);
+    }
+    screen.ApplyShader();
+
+    SubScreen printed(band);
+    screen.CopyTo(printed);
+    if (y != 0)
+      out << "\r\n";
+    out << printed.ToString();
+  }
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -3,7 +3,7 @@
 
 #include <utility>  // for move
 
-#include "ftxui/dom/node.hpp"  // for Node, Elements
+#include "ftxui/dom/node.hpp"  // for Node, Element
 
 namespace ftxui {
 struct Box;
@@ -11,7 +11,7 @@ struct Box;
 // Helper class.
 class NodeDecorator : public Node {
  public:
-  NodeDecorator(Elements children) : Node(std::move(children)) {}
+  NodeDecorator(Element child) : Node(std::move(child)) {}
   ~NodeDecorator() override {}
   void ComputeRequirement() override;
   void SetBox(Box box) override;
@@ -0,0 +1,86 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared
+#include <sstream>                  // for stringstream
+#include <string>                   // for allocator, basic_string, string
+
+#include "ftxui/dom/elements.hpp"   // for text, operator|, Element, border, vbox, separator, bold
+#include "ftxui/dom/node.hpp"       // for Node, Render, RenderMeasured, RenderStreaming
+#include "ftxui/screen/box.hpp"     // for ftxui
+#include "ftxui/screen/screen.hpp"  // for Screen, Dimension
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// Keeps its box to itself: Node::box() isn't known.
+class OwnBox : public Node {
+ public:
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+  void SetBox(Box box) override { own_box_ = box; }
+  void Render(Screen& screen) override {
+    screen.PixelAt(own_box_.x_min, own_box_.y_min).character = L"o";
+  }
+
+ private:
+  Box own_box_;
+};
+
+}  // namespace
+
+TEST(NodeTest, RenderMeasured) {
+  Element document = hbox({
+      text(L"left") | border,
+      text(L"right") | border | flex,
+  });
+
+  auto screen = Screen::Create(Dimension::Fixed(14), Dimension::Fit(document));
+  RenderMeasured(screen, document);
+  EXPECT_EQ(
+      "┌────┐┌──────┐\r\n"
+      "│left││right │\r\n"
+      "└────┘└──────┘",
+      screen.ToString());
+}
+
+TEST(NodeTest, RenderStreaming) {
+  Elements lines;
+  for (int i = 0; i < 10; ++i) {
+    lines.push_back(text(L"line " + std::to_wstring(i)) | bold);
+    lines.push_back(separator());
+  }
+  Element document = vbox(std::move(lines)) | border;
+
+  Screen screen(8, 22);
+  Render(screen, document);
+
+  // The separators are merged with the border, whatever the band.
+  for (int band_height : {1, 2, 3, 7, 22, 100}) {
+    std::stringstream out;
+    RenderStreaming(out, document, 8, band_height);
+    EXPECT_EQ(screen.ToString(), out.str());
+  }
+}
+
+// The children whose box isn't known are drawn in every band.
+TEST(NodeTest, RenderStreamingUnknownBox) {
+  Elements lines;
+  for (int i = 0; i < 10; ++i)
+    lines.push_back(text(L"line"));
+  lines[7] = std::make_shared<OwnBox>();
+  Element document = vbox(std::move(lines));
+
+  std::stringstream out;
+  RenderStreaming(out, document, 4, 1);
+  EXPECT_EQ(out.str(),
+            "line\r\nline\r\nline\r\nline\r\nline\r\nline\r\nline\r\n"
+            "o   \r\nline\r\nline");
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,79 @@
+#include <memory>   // for make_shared, make_unique, unique_ptr
+#include <utility>  // for move
+
+#include "ftxui/dom/node.hpp"  // for Node
+#include "ftxui/dom/offscreen.hpp"
+#include "ftxui/dom/retained_node.hpp"  // for RetainedNode
+#include "ftxui/dom/sub_screen.hpp"     // for SubScreen, kNoCursor, HasCursor
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen
+
+namespace ftxui {
+
+namespace {
+bool SameSize(Box a, Box b) {
+  return a.x_max - a.x_min == b.x_max - b.x_min &&
+         a.y_max - a.y_min == b.y_max - b.y_min;
+}
+}  // namespace
+
+// Wrap the element built for a version. It is drawn into |buffer_| at the
+// first frame, and copied from there at the next ones.
+class OffscreenNode : public RetainedNode {
+ public:
+  void Render(Screen& screen) override {
+    if (!buffer_)
+      Draw();
+
+    buffer_->CopyTo(screen);
+    if (has_cursor_)
+      screen.SetCursor({box_.x_min + cursor_.x, box_.y_min + cursor_.y});
+  }
+
+ private:
+  void Forget() override { buffer_.reset(); }
+
+  // Moved without being resized: the cells drawn are still valid. The child
+  // is laid out again anyway, so that the boxes it reflects are right.
+  void Relayout(Box box) override {
+    if (buffer_ && SameSize(box, box_))
+      buffer_->MoveTo(box.x_min, box.y_min);
+    else
+      buffer_.reset();
+  }
+
+  void Draw() {
+    buffer_ = std::make_unique<SubScreen>(box_);
+    buffer_->SetCursor(kNoCursor);
+    children_[0]->Render(*buffer_);
+
+    // The cursor is kept relative to the box, which may move.
+    Screen::Cursor cursor = buffer_->cursor();
+    has_cursor_ = HasCursor(*buffer_);
+    cursor_ = {cursor.x - box_.x_min, cursor.y - box_.y_min};
+  }
+
+  std::unique_ptr<SubScreen> buffer_;
+  bool has_cursor_ = false;
+  Screen::Cursor cursor_;
+};
+
+Offscreen::Offscreen() = default;
+Offscreen::~Offscreen() = default;
+
+Element Offscreen::Render(size_t version, std::function<Element()> build) {
+  if (node_ && version == version_)
+    return node_;
+
+  if (!node_)
+    node_ = std::make_shared<OffscreenNode>();
+  node_->Rebuild(build());
+  version_ = version;
+  return node_;
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
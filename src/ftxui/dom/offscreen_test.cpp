@@ -0,0 +1,132 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared
+#include <string>                   // for allocator, basic_string, string
+
+#include "ftxui/dom/elements.hpp"   // for text, operator|, Element, border, hbox, vbox
+#include "ftxui/dom/node.hpp"       // for Node, Render
+#include "ftxui/dom/offscreen.hpp"  // for Offscreen
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// Draws "#", counting its layouts and drawings.
+class Counter : public Node {
+ public:
+  Counter(int* layouts, int* drawings)
+      : layouts_(layouts), drawings_(drawings) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    (*layouts_)++;
+  }
+
+  void Render(Screen& screen) override {
+    screen.at(box_.x_min, box_.y_min) = L'#';
+    (*drawings_)++;
+  }
+
+ private:
+  int* layouts_;
+  int* drawings_;
+};
+
+}  // namespace
+
+TEST(OffscreenTest, DrawnOnce) {
+  Offscreen offscreen;
+  int builds = 0;
+  int layouts = 0;
+  int drawings = 0;
+  auto build = [&] {
+    builds++;
+    return std::make_shared<Counter>(&layouts, &drawings) | border;
+  };
+
+  for (int i = 0; i < 3; ++i) {
+    Screen screen(5, 3);
+    Render(screen, hbox({text(L"a"), offscreen.Render(0, build)}));
+    EXPECT_EQ(
+        "a┌─┐ \r\n"
+        " │#│ \r\n"
+        " └─┘ ",
+        screen.ToString());
+  }
+  EXPECT_EQ(builds, 1);
+  EXPECT_EQ(layouts, 1);
+  EXPECT_EQ(drawings, 1);
+
+  // A new version is built and drawn again.
+  Screen screen(5, 3);
+  Render(screen, hbox({text(L"a"), offscreen.Render(1, build)}));
+  EXPECT_EQ(builds, 2);
+  EXPECT_EQ(drawings, 2);
+}
+
+TEST(OffscreenTest, Moved) {
+  Offscreen offscreen;
+  int layouts = 0;
+  int drawings = 0;
+  auto build = [&] {
+    return std::make_shared<Counter>(&layouts, &drawings) | border;
+  };
+
+  Screen screen(6, 3);
+  Render(screen, hbox({text(L"a"), offscreen.Render(0, build)}));
+  screen.Clear();
+  Render(screen, hbox({text(L"abc"), offscreen.Render(0, build)}));
+  EXPECT_EQ(
+      "abc┌─┐\r\n"
+      "   │#│\r\n"
+      "   └─┘",
+      screen.ToString());
+
+  // Moving lays the element out again, without drawing it.
+  EXPECT_EQ(layouts, 2);
+  EXPECT_EQ(drawings, 1);
+}
+
+TEST(OffscreenTest, Resized) {
+  Offscreen offscreen;
+  int layouts = 0;
+  int drawings = 0;
+  auto build = [&] {
+    return std::make_shared<Counter>(&layouts, &drawings) | border | flex;
+  };
+
+  Screen small(3, 3);
+  Render(small, offscreen.Render(0, build));
+  Screen large(4, 3);
+  Render(large, offscreen.Render(0, build));
+  EXPECT_EQ(
+      "┌──┐\r\n"
+      "│# │\r\n"
+      "└──┘",
+      large.ToString());
+  EXPECT_EQ(drawings, 2);
+}
+
+TEST(OffscreenTest, Clipped) {
+  Offscreen offscreen;
+  auto build = [&] { return vbox({text(L"0"), text(L"1"), text(L"2")}); };
+
+  Screen screen(1, 2);
+  Render(screen, vbox({text(L"a"), offscreen.Render(0, build)}));
+  EXPECT_EQ(
+      "a\r\n"
+      "0",
+      screen.ToString());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
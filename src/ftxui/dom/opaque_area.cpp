@@ -0,0 +1,55 @@
+#include <climits>  // for INT_MAX, INT_MIN
+
+#include "ftxui/dom/opaque_area.hpp"
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+
+namespace {
+thread_local OpaqueArea* current = nullptr;
+
+bool IsEmpty(const Box& box) {
+  return box.x_min > box.x_max || box.y_min > box.y_max;
+}
+}  // namespace
+
+OpaqueArea::OpaqueArea() : parent_(current) {
+  clip_ = parent_ ? parent_->clip_ : Box{INT_MIN, INT_MAX, INT_MIN, INT_MAX};
+  current = this;
+}
+
+OpaqueArea::~OpaqueArea() {
+  current = parent_;
+  if (!parent_)
+    return;
+  for (const Box& box : boxes_)
+    Add(box);
+}
+
+// static
+void OpaqueArea::Add(Box box) {
+  if (!current)
+    return;
+  box = Box::Intersection(box, current->clip_);
+  if (!IsEmpty(box))
+    current->boxes_.push_back(box);
+}
+
+OpaqueArea::Clip::Clip(Box box) {
+  if (!current)
+    return;
+  previous_ = current->clip_;
+  current->clip_ = Box::Intersection(box, current->clip_);
+}
+
+OpaqueArea::Clip::~Clip() {
+  if (!current)
+    return;
+  current->clip_ = previous_;
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,47 @@
+#ifndef FTXUI_DOM_OPAQUE_AREA_HPP
+#define FTXUI_DOM_OPAQUE_AREA_HPP
+
+#include <vector>  // for vector
+
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+
+// Collect the boxes entirely overwritten by the elements laid out while it is
+// alive on this thread, like the ones decorated by clear_under. What's drawn
+// before below them can't be seen. The boxes are forwarded to the enclosing
+// OpaqueArea when destroyed.
+class OpaqueArea {
+ public:
+  OpaqueArea();
+  ~OpaqueArea();
+
+  const std::vector<Box>& boxes() const { return boxes_; }
+
+  // Called by the elements overwriting their whole |box|.
+  static void Add(Box box);
+
+  // Restrict the boxes added while it is alive to |box|. Used by the elements
+  // clipping their children, like frame.
+  class Clip {
+   public:
+    Clip(Box box);
+    ~Clip();
+
+   private:
+    Box previous_;
+  };
+
+ private:
+  std::vector<Box> boxes_;
+  Box clip_;
+  OpaqueArea* parent_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_OPAQUE_AREA_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
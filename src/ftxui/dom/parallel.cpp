@@ -0,0 +1,287 @@
+#include <stddef.h>            // for size_t
+#include <algorithm>           // for partition_point
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <memory>              // for shared_ptr, make_shared, unique_ptr, make_unique
+#include <mutex>               // for mutex, unique_lock, lock_guard
+#include <thread>              // for thread
+#include <utility>             // for move, swap
+#include <vector>              // for vector
+
+#include "ftxui/dom/node.hpp"        // for Node, Elements, SetRenderThreads
+#include "ftxui/dom/parallel.hpp"    // for Layout, RenderDisjoint
+#include "ftxui/dom/sub_screen.hpp"  // for SubScreen, kNoCursor, HasCursor
+#include "ftxui/screen/box.hpp"      // for Box
+#include "ftxui/screen/screen.hpp"   // for Screen, Screen::Cursor
+#include "ftxui/util/autoreset.hpp"  // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+// Children smaller than this are drawn on the calling thread. Copying their
+// pixels in and out would cost more than drawing them.
+const int kMinimumArea = 512;
+
+// Whether the current thread is drawing a task. The containers inside a task
+// draw their children on the same thread.
+thread_local bool in_task = false;
+
+class ThreadPool {
+ public:
+  ThreadPool(int threads) {
+    for (int i = 0; i < threads; ++i)
+      threads_.emplace_back([this] { Work(); });
+  }
+
+  ~ThreadPool() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    wake_up_.notify_all();
+    for (auto& thread : threads_)
+      thread.join();
+  }
+
+  // Execute every task and return once they are all done. The calling thread
+  // executes some of them too.
+  void Run(std::vector<std::function<void()>> tasks) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    pending_ += tasks.size();
+    for (auto& task : tasks)
+      queue_.push_back(std::move(task));
+    wake_up_.notify_all();
+
+    while (!queue_.empty())
+      Execute(lock);
+    done_.wait(lock, [&] { return pending_ == 0; });
+  }
+
+ private:
+  void Work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      wake_up_.wait(lock, [&] { return quit_ || !queue_.empty(); });
+      if (queue_.empty())
+        return;
+      Execute(lock);
+    }
+  }
+
+  // Pop a task and execute it, without holding the |lock| meanwhile.
+  void Execute(std::unique_lock<std::mutex>& lock) {
+    std::function<void()> task = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    {
+      AutoReset<bool> in_task_reset(&in_task, true);
+      task();
+    }
+    lock.lock();
+    if (--pending_ == 0)
+      done_.notify_all();
+  }
+
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable wake_up_;
+  std::condition_variable done_;
+  std::deque<std::function<void()>> queue_;
+  size_t pending_ = 0;
+  bool quit_ = false;
+};
+
+// The pool set by SetRenderThreads(). It may be replaced while other threads
+// draw: they keep a reference to the one they use.
+std::mutex thread_pool_mutex;
+std::shared_ptr<ThreadPool> thread_pool;
+// Whether |thread_pool| is set, checked without locking.
+std::atomic<bool> thread_pool_set(false);
+
+std::shared_ptr<ThreadPool> CurrentThreadPool() {
+  if (!thread_pool_set)
+    return nullptr;
+  std::lock_guard<std::mutex> lock(thread_pool_mutex);
+  return thread_pool;
+}
+
+int Area(const Box& box) {
+  if (box.x_min > box.x_max || box.y_min > box.y_max)
+    return 0;
+  return (box.x_max - box.x_min + 1) * (box.y_max - box.y_min + 1);
+}
+
+// Whether |child| can draw something within the stencil. The others are
+// skipped: drawing only a band of a tall document costs only this band. The
+// box of a child whose SetBox() doesn't call Node::SetBox() isn't known, it is
+// always drawn.
+bool Visible(Screen& screen, const Element& child) {
+  if (!child->box_known())
+    return true;
+  const Box box = child->box();
+  const Box& stencil = screen.stencil;
+  return box.x_min <= stencil.x_max && box.x_max >= stencil.x_min &&
+         box.y_min <= stencil.y_max && box.y_max >= stencil.y_min;
+}
+
+// The children that can intersect the stencil along |layout|, as the range
+// [begin, end) of indices. For sorted children, the last row/column of the
+// boxes is non decreasing, and so is the first one.
+void VisibleRange(Screen& screen,
+                  const Node::Children& children,
+                  Layout layout,
+                  size_t& begin,
+                  size_t& end) {
+  const Box& stencil = screen.stencil;
+  const Element* first = children.begin();
+  const Element* last = children.end();
+  switch (layout) {
+    case Layout::Any:
+      break;
+    case Layout::Vertical:
+      first = std::partition_point(first, last, [&](const Element& child) {
+        return child->box().y_max < stencil.y_min;
+      });
+      last = std::partition_point(first, last, [&](const Element& child) {
+        return child->box().y_min <= stencil.y_max;
+      });
+      break;
+    case Layout::Horizontal:
+      first = std::partition_point(first, last, [&](const Element& child) {
+        return child->box().x_max < stencil.x_min;
+      });
+      last = std::partition_point(first, last, [&](const Element& child) {
+        return child->box().x_min <= stencil.x_max;
+      });
+      break;
+  }
+  begin = first - children.begin();
+  end = last - children.begin();
+}
+
+// Draw |child| clipped to its own box, as the ones drawn in parallel are. The
+// output then doesn't depend on the number of threads.
+void RenderClipped(Screen& screen, const Element& child) {
+  if (!child->box_known()) {
+    child->Render(screen);
+    return;
+  }
+  AutoReset<Box> stencil(&screen.stencil,
+                         Box::Intersection(child->box(), screen.stencil));
+  child->Render(screen);
+}
+
+}  // namespace
+
+/// @brief Draw the large children of hbox, vbox and gridbox in parallel.
+/// @param threads The number of threads helping the one calling Render. Zero,
+///                the default, draws everything on the calling thread.
+/// @ingroup dom
+///
+/// Each of those children is drawn into its own buffer and clipped to its own
+/// box. The buffers are copied into the screen in the children's order, so
+/// the output doesn't depend on the scheduling.
+///
+/// It can be called while other threads are drawing. They finish with the
+/// previous threads, which stop afterward.
+void SetRenderThreads(int threads) {
+  std::shared_ptr<ThreadPool> pool;
+  if (threads > 0)
+    pool = std::make_shared<ThreadPool>(threads);
+  std::lock_guard<std::mutex> lock(thread_pool_mutex);
+  std::swap(pool, thread_pool);
+  thread_pool_set = thread_pool != nullptr;
+  // The previous pool is released here, or by the last thread drawing with it.
+}
+
+Layout SearchableLayout(const Node::Children& children, Layout layout) {
+  for (const auto& child : children) {
+    if (!child->box_known())
+      return Layout::Any;
+  }
+  return layout;
+}
+
+void RenderDisjoint(Screen& screen,
+                    const Node::Children& children,
+                    Layout layout) {
+  size_t begin = 0;
+  size_t end = 0;
+  VisibleRange(screen, children, layout, begin, end);
+
+  std::shared_ptr<ThreadPool> pool;
+  if (!in_task)
+    pool = CurrentThreadPool();
+
+  std::vector<bool> is_task(end - begin, false);
+  int task_count = 0;
+  if (pool) {
+    for (size_t i = 0; i < is_task.size(); ++i) {
+      const Element& child = children[begin + i];
+      Box area = Box::Intersection(child->box(), screen.stencil);
+      is_task[i] = child->box_known() && Area(area) >= kMinimumArea;
+      task_count += is_task[i];
+    }
+  }
+
+  if (task_count < 2) {
+    for (size_t i = begin; i < end; ++i) {
+      if (Visible(screen, children[i]))
+        RenderClipped(screen, children[i]);
+    }
+    return;
+  }
+
+  // Track which child sets the cursor last, as drawing them in order would do.
+  Screen::Cursor cursor = screen.cursor();
+
+  std::vector<std::unique_ptr<SubScreen>> screens(end - begin);
+  std::vector<std::function<void()>> tasks;
+  for (size_t i = 0; i < screens.size(); ++i) {
+    if (!is_task[i])
+      continue;
+    const Element& child = children[begin + i];
+    screens[i] = std::make_unique<SubScreen>(
+        Box::Intersection(child->box(), screen.stencil));
+    screens[i]->CopyFrom(screen);
+    screens[i]->SetCursor(kNoCursor);
+    tasks.push_back([node = child.get(), sub_screen = screens[i].get()] {
+      node->Render(*sub_screen);
+    });
+  }
+
+  // The small children don't overlap the large ones, they can be drawn before.
+  size_t cursor_child = 0;
+  for (size_t i = 0; i < screens.size(); ++i) {
+    if (is_task[i] || !Visible(screen, children[begin + i]))
+      continue;
+    screen.SetCursor(kNoCursor);
+    RenderClipped(screen, children[begin + i]);
+    if (HasCursor(screen)) {
+      cursor = screen.cursor();
+      cursor_child = i;
+    }
+  }
+
+  pool->Run(std::move(tasks));
+
+  for (size_t i = 0; i < screens.size(); ++i) {
+    if (!is_task[i])
+      continue;
+    screens[i]->CopyTo(screen);
+    if (HasCursor(*screens[i]) && i >= cursor_child) {
+      cursor = screens[i]->cursor();
+      cursor_child = i;
+    }
+  }
+  screen.SetCursor(cursor);
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
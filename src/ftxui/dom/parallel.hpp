@@ -0,0 +1,39 @@
+#ifndef FTXUI_DOM_PARALLEL_HPP
+#define FTXUI_DOM_PARALLEL_HPP
+
+#include "ftxui/dom/node.hpp"  // for Node
+
+namespace ftxui {
+class Screen;
+
+// How the boxes of the children are ordered.
+enum class Layout {
+  Any,
+  // Sorted from top to bottom, like the children of vbox.
+  Vertical,
+  // Sorted from left to right, like the children of hbox.
+  Horizontal,
+};
+
+// Draw |children|, whose boxes don't overlap. When enabled with
+// SetRenderThreads(), the large ones are drawn in parallel into private
+// buffers, then copied into |screen| in order. Every child is clipped to its
+// own box, whether drawn in parallel or not. The children outside of the
+// stencil aren't drawn. When they are sorted according to |layout|, the
+// visible ones are found by binary search, without looking at the others.
+void RenderDisjoint(Screen& screen,
+                    const Node::Children& children,
+                    Layout layout = Layout::Any);
+
+// |layout| when the boxes of all the |children| are known, Layout::Any
+// otherwise: the unknown ones can't be searched. Called once laid out, so
+// that drawing the children doesn't look at each of them.
+Layout SearchableLayout(const Node::Children& children, Layout layout);
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_PARALLEL_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,96 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <atomic>                   // for atomic
+#include <memory>                   // for make_shared
+#include <string>                   // for allocator, wstring, to_wstring
+#include <thread>                   // for thread
+#include <vector>                   // for vector
+
+#include "ftxui/dom/elements.hpp"    // for text, operator|, Element, border
+#include "ftxui/dom/node.hpp"        // for Node, Render, SetRenderThreads
+#include "ftxui/screen/box.hpp"      // for ftxui
+#include "ftxui/screen/color.hpp"    // for Color
+#include "ftxui/screen/screen.hpp"   // for Screen
+#include "gtest/gtest_pred_impl.h"   // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// Draws one column more than its box.
+class Overflow : public Node {
+ public:
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen& screen) override {
+    for (int x = box_.x_min; x <= box_.x_max + 1; ++x)
+      screen.PixelAt(x, box_.y_min).character = L"x";
+  }
+};
+
+Element Document() {
+  Elements columns;
+  for (int x = 0; x < 4; ++x) {
+    Elements lines;
+    for (int y = 0; y < 30; ++y) {
+      auto line = text(L"line " + std::to_wstring(x * 100 + y));
+      if (y % 3 == 0)
+        line = line | color(Color::Red) | bold;
+      if (x == 2 && y == 7)
+        line = line | focus;
+      lines.push_back(line);
+    }
+    columns.push_back(vbox(std::move(lines)) | border | flex);
+  }
+  return hbox(std::move(columns));
+}
+
+}  // namespace
+
+TEST(ParallelTest, SameAsSerial) {
+  Screen expected(80, 32);
+  Render(expected, Document());
+
+  SetRenderThreads(3);
+  Screen screen(80, 32);
+  Render(screen, Document());
+  SetRenderThreads(0);
+
+  EXPECT_EQ(expected.ToString(), screen.ToString());
+  EXPECT_EQ(expected.cursor().x, screen.cursor().x);
+  EXPECT_EQ(expected.cursor().y, screen.cursor().y);
+}
+
+// The threads can be changed while another thread is drawing.
+TEST(ParallelTest, SetRenderThreadsWhileRendering) {
+  Screen expected(80, 32);
+  Render(expected, Document());
+
+  std::atomic<bool> stop(false);
+  std::thread renderer([&] {
+    while (!stop) {
+      Screen screen(80, 32);
+      Render(screen, Document());
+      EXPECT_EQ(expected.ToString(), screen.ToString());
+    }
+  });
+  for (int i = 0; i < 50; ++i)
+    SetRenderThreads(i % 3);
+  stop = true;
+  renderer.join();
+  SetRenderThreads(0);
+}
+
+// Whether drawn in parallel or not, the children are clipped to their box.
+TEST(ParallelTest, ChildrenAreClippedToTheirBox) {
+  Screen screen(4, 1);
+  auto overflow = std::make_shared<Overflow>();
+  Render(screen, hbox({overflow | size(WIDTH, EQUAL, 2), filler()}));
+  EXPECT_EQ(screen.ToString(), "xx  ");
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,131 @@
+#include <stddef.h>  // for size_t
+#include <memory>    // for make_shared, shared_ptr
+#include <mutex>     // for mutex, lock_guard
+#include <typeinfo>  // for type_info
+#include <utility>   // for move
+#include <vector>    // for vector
+
+#include "ftxui/dom/profiled_node.hpp"
+#include "ftxui/screen/profiler.hpp"  // for Scope, Phase
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// A child replaced by a ProfiledNode. The parent may have replaced its
+// children since, so the slot isn't kept: it is searched for again, from the
+// index it had.
+struct Wrapped {
+  Element owner;  // Keeps |parent| alive. Null for the instrumented root.
+  Node* parent;
+  size_t index;
+  Element wrapper;
+};
+
+// The children wrapped, in order. The children of the large containers may
+// be wrapped by the threads drawing them.
+std::mutex wrapped_mutex;
+std::vector<Wrapped> wrapped;
+
+}  // namespace
+
+// The requirement and the box are copied: the child may have been measured
+// before being wrapped.
+ProfiledNode::ProfiledNode(Element child) : Node(std::move(child)) {
+  requirement_ = children_[0]->requirement();
+  box_ = children_[0]->box_;
+  box_known_ = children_[0]->box_known_;
+}
+
+void ProfiledNode::ComputeRequirement() {
+  Node& child = *children_[0];
+  WrapChildren();
+  {
+    profiler::Scope scope(profiler::Phase::ComputeRequirement, &typeid(child));
+    child.ComputeRequirement();
+  }
+  requirement_ = child.requirement();
+}
+
+void ProfiledNode::SetBox(Box box) {
+  Node::SetBox(box);
+  Node& child = *children_[0];
+  WrapChildren();
+  profiler::Scope scope(profiler::Phase::SetBox, &typeid(child));
+  child.SetBox(box);
+}
+
+void ProfiledNode::Render(Screen& screen) {
+  Node& child = *children_[0];
+  WrapChildren();
+  profiler::Scope scope(profiler::Phase::Render, &typeid(child));
+  child.Render(screen);
+}
+
+// The same hash as the child, so that wrapping an element doesn't change the
+// frames considered identical.
+bool ProfiledNode::Hash(StructuralHash& hash) {
+  return children_[0]->Hash(hash);
+}
+
+bool ProfiledNode::CullsByStencil() const {
+  return children_[0]->CullsByStencil();
+}
+
+// static
+void ProfiledNode::Wrap(Node* node, Element owner) {
+  std::lock_guard<std::mutex> lock(wrapped_mutex);
+  for (size_t i = 0; i < node->children_.size(); ++i) {
+    Element& child = node->children_[i];
+    if (dynamic_cast<ProfiledNode*>(child.get()))
+      continue;
+    child = std::make_shared<ProfiledNode>(std::move(child));
+    wrapped.push_back({owner, node, i, child});
+  }
+}
+
+// static
+void ProfiledNode::Unwrap(Node* parent, size_t index, const Element& wrapper) {
+  auto& children = parent->children_;
+  size_t i = index;
+  if (i >= children.size() || children[i] != wrapper) {
+    i = 0;
+    while (i < children.size() && children[i] != wrapper)
+      i++;
+    // The parent doesn't hold the ProfiledNode anymore.
+    if (i == children.size())
+      return;
+  }
+  children[i] = wrapper->children_[0];
+}
+
+void ProfiledNode::WrapChildren() {
+  if (wrapped_)
+    return;
+  Wrap(children_[0].get(), children_[0]);
+  wrapped_ = true;
+}
+
+ProfiledNode::Instrumentation::Instrumentation(Node* node) {
+  {
+    std::lock_guard<std::mutex> lock(wrapped_mutex);
+    first_ = wrapped.size();
+  }
+  Wrap(node, nullptr);
+}
+
+ProfiledNode::Instrumentation::~Instrumentation() {
+  std::lock_guard<std::mutex> lock(wrapped_mutex);
+  while (wrapped.size() > first_) {
+    const Wrapped& entry = wrapped.back();
+    Unwrap(entry.parent, entry.index, entry.wrapper);
+    wrapped.pop_back();
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
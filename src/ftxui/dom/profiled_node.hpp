@@ -0,0 +1,59 @@
+#ifndef FTXUI_DOM_PROFILED_NODE_HPP
+#define FTXUI_DOM_PROFILED_NODE_HPP
+
+#include <stddef.h>  // for size_t
+
+#include "ftxui/dom/elements.hpp"         // for Element
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+
+namespace ftxui {
+
+// Forward the calls to its child, measuring them with the profiler. The
+// children of its child are wrapped when it is first called. So the subtrees
+// whose calls are skipped, like the ones kept by a Reconciler, aren't walked.
+class ProfiledNode : public Node {
+ public:
+  ProfiledNode(Element child);
+
+  void ComputeRequirement() override;
+  void SetBox(Box box) override;
+  void Render(Screen& screen) override;
+  bool Hash(StructuralHash& hash) override;
+  bool CullsByStencil() const override;
+
+  // Wrap the children of |node| into ProfiledNodes, and then their own
+  // children as they are called. The tree is restored when destroyed.
+  class Instrumentation {
+   public:
+    Instrumentation(Node* node);
+    ~Instrumentation();
+
+    Instrumentation(const Instrumentation&) = delete;
+    Instrumentation& operator=(const Instrumentation&) = delete;
+
+   private:
+    size_t first_;
+  };
+
+ private:
+  // Wrap the children of |node| which aren't already. |owner| is |node|, or
+  // null when it is the root.
+  static void Wrap(Node* node, Element owner);
+  // Put back the child replaced by |wrapper|, if |parent| still holds it. It
+  // was at |index|.
+  static void Unwrap(Node* parent, size_t index, const Element& wrapper);
+  // Wrap the children of the child, once.
+  void WrapChildren();
+
+  bool wrapped_ = false;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_PROFILED_NODE_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,121 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared, shared_ptr
+#include <utility>                  // for move
+
+#include "ftxui/dom/elements.hpp"         // for text, vbox, Element
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/profiled_node.hpp"    // for ProfiledNode
+#include "ftxui/dom/reconciler.hpp"       // for Reconciler
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/screen.hpp"        // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ, ASSERT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+// Lay out its children at its own place.
+class Tree : public Node {
+ public:
+  Tree(Elements children) : Node(std::move(children)) {}
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    for (auto& child : children_)
+      child->SetBox(box);
+  }
+  const Children& children() const { return children_; }
+};
+
+// Replace its children at every layout, like vgrid.
+class Rebuilt : public Node {
+ public:
+  Rebuilt(Elements children) : Node(std::move(children)) {}
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    children_.clear();
+    children_.push_back(text(L"new"));
+    for (auto& child : children_)
+      child->SetBox(box);
+  }
+  const Children& children() const { return children_; }
+};
+
+void Draw(Screen& screen, const Element& element) {
+  element->ComputeRequirement();
+  element->SetBox({0, screen.dimx() - 1, 0, screen.dimy() - 1});
+  element->Render(screen);
+}
+
+}  // namespace
+
+TEST(ProfiledNodeTest, Hash) {
+  StructuralHash expected;
+  EXPECT_TRUE(text(L"hello")->Hash(expected));
+
+  StructuralHash hash;
+  ProfiledNode node(text(L"hello"));
+  EXPECT_TRUE(node.Hash(hash));
+  EXPECT_EQ(hash.value(), expected.value());
+}
+
+TEST(ProfiledNodeTest, TreeIsRestored) {
+  Element leaf = text(L"leaf");
+  auto inner = std::make_shared<Tree>(Elements{leaf});
+  auto root = std::make_shared<Tree>(Elements{inner});
+
+  Screen screen(4, 1);
+  {
+    ProfiledNode::Instrumentation instrumentation(root.get());
+    EXPECT_NE(root->children()[0], inner);
+    Draw(screen, root);
+    EXPECT_NE(inner->children()[0], leaf);
+  }
+  EXPECT_EQ(root->children()[0], inner);
+  EXPECT_EQ(inner->children()[0], leaf);
+  EXPECT_EQ(screen.ToString(), "leaf");
+}
+
+// A child replaced by its parent isn't put back.
+TEST(ProfiledNodeTest, ReplacedChildrenAreKept) {
+  auto rebuilt = std::make_shared<Rebuilt>(Elements{text(L"old")});
+  auto root = std::make_shared<Tree>(Elements{rebuilt});
+
+  Screen screen(4, 1);
+  {
+    ProfiledNode::Instrumentation instrumentation(root.get());
+    Draw(screen, root);
+  }
+  EXPECT_EQ(root->children()[0], rebuilt);
+  ASSERT_EQ(rebuilt->children().size(), 1u);
+  EXPECT_EQ(dynamic_cast<ProfiledNode*>(rebuilt->children()[0].get()),
+            nullptr);
+  EXPECT_EQ(screen.ToString(), "new ");
+}
+
+// The subtrees kept by a Reconciler aren't walked when they aren't called.
+TEST(ProfiledNodeTest, RetainedSubtreeIsSkipped) {
+  Reconciler reconciler;
+  Element leaf = text(L"leaf");
+  auto kept = std::make_shared<Tree>(Elements{leaf});
+  auto root = std::make_shared<Tree>(
+      Elements{reconciler.Keyed("kept", 0, [&] { return kept; })});
+
+  Screen screen(4, 1);
+  {
+    ProfiledNode::Instrumentation instrumentation(root.get());
+    Draw(screen, root);
+  }
+  screen.Clear();
+  {
+    ProfiledNode::Instrumentation instrumentation(root.get());
+    Draw(screen, root);
+    EXPECT_EQ(kept->children()[0], leaf);
+  }
+  EXPECT_EQ(screen.ToString(), "leaf");
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
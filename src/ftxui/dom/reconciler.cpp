@@ -0,0 +1,142 @@
+#include <algorithm>  // for find_if, rotate
+#include <memory>     // for make_shared, shared_ptr
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/node.hpp"  // for Node
+#include "ftxui/dom/reconciler.hpp"
+#include "ftxui/dom/retained_node.hpp"  // for RetainedNode
+#include "ftxui/dom/sub_screen.hpp"     // for kNoCursor, HasCursor
+#include "ftxui/screen/box.hpp"         // for Box
+#include "ftxui/screen/screen.hpp"      // for Screen, Pixel, RowWriter
+
+namespace ftxui {
+
+// Wrap the element built for a key. Every step is skipped when its inputs
+// didn't change since the previous frame. This assumes the element draws only
+// inside its box.
+class KeyedNode : public RetainedNode {
+ public:
+  void Render(Screen& screen) override {
+    const Box area = Box::Intersection(box_, screen.stencil);
+    auto it = std::find_if(cells_.begin(), cells_.end(), [&](const Cells& c) {
+      return c.area == area;
+    });
+    if (it != cells_.end() && Matches(screen, *it)) {
+      Write(screen, *it);
+      if (it->has_cursor)
+        screen.SetCursor(it->cursor);
+      std::rotate(it, it + 1, cells_.end());
+      return;
+    }
+
+    // Replace the cells of this area, or the least recently used ones.
+    if (it != cells_.end())
+      cells_.erase(it);
+    else if (cells_.size() == kMaxCells)
+      cells_.erase(cells_.begin());
+    cells_.emplace_back();
+    Cells& cells = cells_.back();
+    cells.area = area;
+    Read(screen, cells.area, &cells.input);
+
+    Screen::Cursor cursor = screen.cursor();
+    screen.SetCursor(kNoCursor);
+    children_[0]->Render(screen);
+    cells.has_cursor = HasCursor(screen);
+    if (cells.has_cursor)
+      cells.cursor = screen.cursor();
+    else
+      screen.SetCursor(cursor);
+
+    Read(screen, cells.area, &cells.output);
+  }
+
+ private:
+  void Forget() override { cells_.clear(); }
+
+  // The cells drawn by the child in |area|, and the cells it was drawn over.
+  struct Cells {
+    Box area;
+    std::vector<Pixel> input;
+    std::vector<Pixel> output;
+    bool has_cursor = false;
+    Screen::Cursor cursor;
+  };
+
+  void Read(Screen& screen, const Box& area, std::vector<Pixel>* pixels) {
+    pixels->clear();
+    for (int y = area.y_min; y <= area.y_max; ++y) {
+      RowWriter row(screen, y, area.x_min, area.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x)
+        pixels->push_back(row.PixelAt(x));
+    }
+  }
+
+  void Write(Screen& screen, const Cells& cells) {
+    auto it = cells.output.begin();
+    for (int y = cells.area.y_min; y <= cells.area.y_max; ++y) {
+      RowWriter row(screen, y, cells.area.x_min, cells.area.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x)
+        row.PixelAt(x) = *it++;
+    }
+  }
+
+  bool Matches(Screen& screen, const Cells& cells) {
+    auto it = cells.input.begin();
+    for (int y = cells.area.y_min; y <= cells.area.y_max; ++y) {
+      RowWriter row(screen, y, cells.area.x_min, cells.area.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        if (row.PixelAt(x) != *it++)
+          return false;
+      }
+    }
+    return true;
+  }
+
+  // An element may be drawn with several stencils in a frame, e.g. inside a
+  // vbox partly hidden by a dialog. The cells of a few areas are kept, the
+  // most recently used last.
+  static const size_t kMaxCells = 8;
+  std::vector<Cells> cells_;
+};
+
+Reconciler::Reconciler() = default;
+Reconciler::~Reconciler() = default;
+
+Element Reconciler::Keyed(const std::string& key,
+                          size_t version,
+                          std::function<Element()> build) {
+  auto it = entries_.find(key);
+  if (it != entries_.end() && it->second.version == version) {
+    it->second.used = true;
+    return it->second.node;
+  }
+
+  // |build| may request other keys, so |entries_| is only modified after.
+  Element child = build();
+  Entry& entry = entries_[key];
+  if (!entry.node)
+    entry.node = std::make_shared<KeyedNode>();
+  entry.node->Rebuild(std::move(child));
+  entry.version = version;
+  entry.used = true;
+  return entry.node;
+}
+
+void Reconciler::Sweep() {
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.used) {
+      it->second.used = false;
+      ++it;
+    } else {
+      it = entries_.erase(it);
+    }
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
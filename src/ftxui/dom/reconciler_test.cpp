@@ -0,0 +1,83 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator, basic_string, string
+
+#include "ftxui/dom/elements.hpp"    // for text, operator|, Element, bold
+#include "ftxui/dom/node.hpp"        // for Render
+#include "ftxui/dom/reconciler.hpp"  // for Reconciler
+#include "ftxui/screen/box.hpp"      // for ftxui
+#include "ftxui/screen/screen.hpp"   // for Screen
+#include "gtest/gtest_pred_impl.h"   // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(ReconcilerTest, BuildOnlyWhenVersionChanges) {
+  Reconciler reconciler;
+  int built = 0;
+  auto build = [&] {
+    built++;
+    return text(L"item");
+  };
+
+  Element a = reconciler.Keyed("a", 0, build);
+  EXPECT_EQ(built, 1);
+  EXPECT_EQ(reconciler.Keyed("a", 0, build), a);
+  EXPECT_EQ(built, 1);
+  EXPECT_EQ(reconciler.Keyed("a", 1, build), a);
+  EXPECT_EQ(built, 2);
+  reconciler.Keyed("b", 1, build);
+  EXPECT_EQ(built, 3);
+}
+
+TEST(ReconcilerTest, Sweep) {
+  Reconciler reconciler;
+  int built = 0;
+  auto build = [&] {
+    built++;
+    return text(L"item");
+  };
+
+  reconciler.Keyed("a", 0, build);
+  reconciler.Keyed("b", 0, build);
+  reconciler.Sweep();
+  reconciler.Keyed("a", 0, build);
+  reconciler.Sweep();
+  EXPECT_EQ(built, 2);
+
+  reconciler.Keyed("a", 0, build);
+  reconciler.Keyed("b", 0, build);
+  EXPECT_EQ(built, 3);
+}
+
+TEST(ReconcilerTest, RenderAgain) {
+  Reconciler reconciler;
+  auto document = [&](std::wstring label) {
+    return hbox({
+        text(label),
+        reconciler.Keyed("static", 0, [] { return text(L"[static]"); }),
+    });
+  };
+
+  Screen screen(12, 1);
+  Render(screen, document(L"one"));
+  EXPECT_EQ("one[static] ", screen.ToString());
+
+  // The element moves: it is drawn again.
+  screen.Clear();
+  Render(screen, document(L"three"));
+  EXPECT_EQ("three[static", screen.ToString());
+
+  // The same place and the same cells below: the cells are copied.
+  screen.Clear();
+  Render(screen, document(L"seven"));
+  EXPECT_EQ("seven[static", screen.ToString());
+
+  // The cells below are different: the element is drawn again over them.
+  screen.Clear();
+  Render(screen, document(L"eight") | bold);
+  EXPECT_EQ("\x1B[1meight[static\x1B[22m", screen.ToString());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
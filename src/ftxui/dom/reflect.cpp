@@ -2,7 +2,7 @@
 #include <utility>  // for move
 #include <vector>   // for __alloc_traits<>::value_type, vector
 
-#include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
+#include "ftxui/dom/elements.hpp"     // for Element, Decorator, reflect
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -13,9 +13,16 @@ namespace ftxui {
 class Reflect : public Node {
  public:
   Reflect(Element child, Box& box)
-      : Node(unpack(std::move(child))), reflected_box_(box) {}
+      : Node(std::move(child)), reflected_box_(box) {}
   ~Reflect() override {}
 
+  // The box receiving the layout is part of the document: a frame drawn with
+  // another one isn't the same.
+  bool Hash(StructuralHash& hash) final {
+    hash.AddPointer(&reflected_box_);
+    return HashChildren(hash);
+  }
+
   void ComputeRequirement() final {
     Node::ComputeRequirement();
     requirement_ = children_[0]->requirement();
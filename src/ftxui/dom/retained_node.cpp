@@ -0,0 +1,60 @@
+#include <utility>  // for move
+
+#include "ftxui/dom/opaque_area.hpp"  // for OpaqueArea
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/retained_node.hpp"
+
+namespace ftxui {
+
+void RetainedNode::Rebuild(Element child) {
+  children_ = {std::move(child)};
+  hash_valid_ = false;
+  requirement_valid_ = false;
+  box_valid_ = false;
+  Forget();
+}
+
+// The hash of the child is computed once per version.
+bool RetainedNode::Hash(StructuralHash& hash) {
+  if (!hash_valid_) {
+    StructuralHash child_hash;
+    hashable_ = children_[0]->Hash(child_hash);
+    hash_ = child_hash.value();
+    hash_valid_ = true;
+  }
+  hash.Add(hash_);
+  return hashable_;
+}
+
+void RetainedNode::ComputeRequirement() {
+  if (requirement_valid_)
+    return;
+  children_[0]->ComputeRequirement();
+  requirement_ = children_[0]->requirement();
+  requirement_valid_ = true;
+}
+
+void RetainedNode::SetBox(Box box) {
+  if (box_valid_ && box == box_) {
+    for (const Box& opaque_box : opaque_boxes_)
+      OpaqueArea::Add(opaque_box);
+    return;
+  }
+
+  Relayout(box);
+  Node::SetBox(box);
+  OpaqueArea opaque_area;
+  children_[0]->SetBox(box);
+  opaque_boxes_ = opaque_area.boxes();
+  box_valid_ = true;
+}
+
+void RetainedNode::Relayout(Box) {
+  Forget();
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,51 @@
+#ifndef FTXUI_DOM_RETAINED_NODE_HPP
+#define FTXUI_DOM_RETAINED_NODE_HPP
+
+#include <stdint.h>  // for uint64_t
+#include <vector>    // for vector
+
+#include "ftxui/dom/elements.hpp"         // for Element
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+
+namespace ftxui {
+
+// Wrap an element kept from one frame to the next, rebuilt when its version
+// changes. Its hash and its requirement are computed once per version, and its
+// layout once per box. Meanwhile, the opaque boxes of the child are added
+// again, so that a dbox still skips what's below them.
+//
+// The subclasses keep what the child draws, and forget it when told to.
+class RetainedNode : public Node {
+ public:
+  // Replace the child by the one built for a new version.
+  void Rebuild(Element child);
+
+  bool Hash(StructuralHash& hash) override;
+  void ComputeRequirement() override;
+  void SetBox(Box box) override;
+
+ protected:
+  // Forget what the previous child drew.
+  virtual void Forget() = 0;
+  // Called before the child is laid out again at |box|. |box_| is still the
+  // previous box. What was drawn is forgotten, unless overridden.
+  virtual void Relayout(Box box);
+
+ private:
+  bool hash_valid_ = false;
+  bool hashable_ = false;
+  uint64_t hash_ = 0;
+  bool requirement_valid_ = false;
+  bool box_valid_ = false;
+  std::vector<Box> opaque_boxes_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_RETAINED_NODE_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
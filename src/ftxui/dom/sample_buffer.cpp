@@ -0,0 +1,44 @@
+#include <algorithm>  // for max, min
+
+#include "ftxui/dom/sample_buffer.hpp"
+
+namespace ftxui {
+
+SampleBuffer::SampleBuffer(size_t capacity)
+    : capacity_(std::max(capacity, size_t(1))),
+      samples_(new std::atomic<float>[capacity_]) {
+  for (size_t i = 0; i < capacity_; ++i)
+    samples_[i].store(0.f, std::memory_order_relaxed);
+}
+
+void SampleBuffer::Push(float sample) {
+  const uint64_t index = pushed_.load(std::memory_order_relaxed);
+  // A reader copying this slot must see |writing_| changed, like a seqlock.
+  writing_.store(index + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  samples_[index % capacity_].store(sample, std::memory_order_relaxed);
+  pushed_.store(index + 1, std::memory_order_release);
+}
+
+void SampleBuffer::Snapshot(size_t count, std::vector<float>* out) const {
+  out->clear();
+  const uint64_t end = pushed_.load(std::memory_order_acquire);
+  const uint64_t begin = end - std::min<uint64_t>({count, end, capacity_});
+  for (uint64_t i = begin; i < end; ++i)
+    out->push_back(samples_[i % capacity_].load(std::memory_order_relaxed));
+
+  // The slots reused by the pushes made meanwhile may have been overwritten.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const uint64_t writing = writing_.load(std::memory_order_relaxed);
+  if (writing > begin + capacity_) {
+    const uint64_t overwritten =
+        std::min<uint64_t>(writing - capacity_ - begin, out->size());
+    out->erase(out->begin(), out->begin() + overwritten);
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
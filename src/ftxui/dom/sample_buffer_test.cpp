@@ -0,0 +1,53 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <thread>                   // for thread
+#include <vector>                   // for vector
+
+#include "ftxui/dom/sample_buffer.hpp"  // for SampleBuffer
+#include "gtest/gtest_pred_impl.h"      // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(SampleBufferTest, Snapshot) {
+  SampleBuffer buffer(4);
+  std::vector<float> samples;
+  buffer.Snapshot(10, &samples);
+  EXPECT_TRUE(samples.empty());
+
+  for (int i = 0; i < 6; ++i)
+    buffer.Push(i);
+  EXPECT_EQ(buffer.pushed(), 6u);
+
+  buffer.Snapshot(10, &samples);
+  EXPECT_EQ(samples, (std::vector<float>{2, 3, 4, 5}));
+  buffer.Snapshot(2, &samples);
+  EXPECT_EQ(samples, (std::vector<float>{4, 5}));
+}
+
+// The snapshots taken while another thread pushes are runs of consecutive
+// samples.
+TEST(SampleBufferTest, Concurrent) {
+  const int kSamples = 200000;
+  SampleBuffer buffer(16);
+  std::thread producer([&] {
+    for (int i = 1; i <= kSamples; ++i)
+      buffer.Push(i);
+  });
+
+  std::vector<float> samples;
+  float last = 0;
+  while (last < kSamples) {
+    buffer.Snapshot(16, &samples);
+    for (size_t i = 1; i < samples.size(); ++i)
+      ASSERT_EQ(samples[i], samples[i - 1] + 1);
+    if (!samples.empty()) {
+      ASSERT_GE(samples.back(), last);
+      last = samples.back();
+    }
+  }
+  producer.join();
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
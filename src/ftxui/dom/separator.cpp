@@ -5,7 +5,7 @@
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
+#include "ftxui/screen/screen.hpp"    // for Pixel, Screen, RowWriter
 
 namespace ftxui {
 
@@ -15,6 +15,9 @@ class Separator : public Node {
  public:
   Separator() {}
   ~Separator() override {}
+
+  bool Hash(StructuralHash& hash) override { return HashChildren(hash); }
+
   void ComputeRequirement() override {
     requirement_.min_x = 1;
     requirement_.min_y = 1;
@@ -31,9 +34,9 @@ class Separator : public Node {
       c = U'│';
 
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).character = c;
-      }
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x)
+        row.PixelAt(x).character = c;
     }
   }
 };
@@ -42,11 +45,17 @@ class SeparatorWithPixel : public Separator {
  public:
   SeparatorWithPixel(Pixel pixel) : pixel_(pixel) {}
   ~SeparatorWithPixel() override {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(pixel_);
+    return HashChildren(hash);
+  }
+
   void Render(Screen& screen) override {
     for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = pixel_;
-      }
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x)
+        row.PixelAt(x) = pixel_;
     }
   }
 
@@ -4,7 +4,7 @@
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type, vector
 
-#include "ftxui/dom/elements.hpp"  // for Constraint, Direction, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
+#include "ftxui/dom/elements.hpp"  // for Constraint, Direction, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, Decorator, Element, size
 #include "ftxui/dom/node.hpp"      // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -14,13 +14,20 @@ namespace ftxui {
 class Size : public Node {
  public:
   Size(Element child, Direction direction, Constraint constraint, size_t value)
-      : Node(unpack(std::move(child))),
+      : Node(std::move(child)),
         direction_(direction),
         constraint_(constraint),
         value_(value) {}
 
   ~Size() override {}
 
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(direction_);
+    hash.Add(constraint_);
+    hash.Add(value_);
+    return HashChildren(hash);
+  }
+
   void ComputeRequirement() override {
     Node::ComputeRequirement();
     requirement_ = children_[0]->requirement();
@@ -0,0 +1,181 @@
+#include <algorithm>  // for max
+#include <memory>     // for make_shared
+#include <string>     // for wstring
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"     // for Element, Span, spans
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Pixel, Screen, RowWriter
+#include "ftxui/screen/string.hpp"    // for wchar_width
+
+namespace ftxui {
+
+namespace {
+
+struct Glyph {
+  wchar_t character;
+  int width;  // Zero for combining characters.
+  int span;
+};
+
+// A word, or a single space, or a single line break.
+struct Segment {
+  int begin;
+  int end;
+  int width;
+};
+
+class Spans : public Node {
+ public:
+  Spans(std::vector<Span> spans, bool wrap)
+      : spans_(std::move(spans)), wrap_(wrap) {
+    for (int i = 0; i < int(spans_.size()); ++i) {
+      for (wchar_t c : spans_[i].text)
+        glyphs_.push_back({c, std::max(wchar_width(c), 0), i});
+    }
+
+    for (int i = 0; i < int(glyphs_.size()); ++i) {
+      wchar_t c = glyphs_[i].character;
+      bool is_word = c != L' ' && c != L'\n';
+      if (is_word && !segments_.empty() && IsWord(segments_.back())) {
+        segments_.back().end++;
+        segments_.back().width += glyphs_[i].width;
+      } else {
+        segments_.push_back({i, i + 1, glyphs_[i].width});
+      }
+      width_ += glyphs_[i].width;
+    }
+  }
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(wrap_);
+    for (const Span& span : spans_) {
+      hash.Add(span.text);
+      hash.Add(span.foreground);
+      hash.Add(span.background);
+      hash.Add(span.bold << 4 | span.dim << 3 | span.inverted << 2 |
+               span.underlined << 1 | span.blink);
+    }
+    return HashChildren(hash);
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = wrap_ ? 1 : width_;
+    requirement_.min_y = 1;
+    requirement_.flex_grow_x = wrap_ ? 1 : 0;
+    requirement_.flex_grow_y = wrap_ ? 1 : 0;
+  }
+
+  void Render(Screen& screen) override {
+    int x = box_.x_min;
+    int y = box_.y_min;
+    for (const Segment& segment : segments_) {
+      if (glyphs_[segment.begin].character == L'\n') {
+        if (wrap_) {
+          x = box_.x_min;
+          y++;
+        }
+        continue;
+      }
+
+      // Wrap before the segments not fitting the end of the line. The spaces
+      // there are dropped.
+      if (wrap_ && x + segment.width - 1 > box_.x_max && x != box_.x_min) {
+        x = box_.x_min;
+        y++;
+        if (!IsWord(segment))
+          continue;
+      }
+
+      if (y > box_.y_max)
+        return;
+      x = Draw(screen, segment, x, y);
+    }
+  }
+
+ private:
+  bool IsWord(const Segment& segment) const {
+    wchar_t c = glyphs_[segment.begin].character;
+    return c != L' ' && c != L'\n';
+  }
+
+  // Draw the glyphs of |segment| from (x, y). Return the next x.
+  int Draw(Screen& screen, const Segment& segment, int x, int y) {
+    RowWriter row(screen, y, box_.x_min, box_.x_max);
+    for (int i = segment.begin; i < segment.end; ++i) {
+      const Glyph& glyph = glyphs_[i];
+      if (glyph.width == 0) {
+        if (row.Contain(x - 1))
+          row.PixelAt(x - 1).character += glyph.character;
+        continue;
+      }
+      // Words longer than a line are cut.
+      if (x + glyph.width - 1 > box_.x_max)
+        return x;
+      if (!row.Contain(x)) {
+        x += glyph.width;
+        continue;
+      }
+
+      const Span& span = spans_[glyph.span];
+      Pixel& pixel = row.PixelAt(x);
+      pixel.character = glyph.character;
+      if (span.foreground != Color::Default)
+        pixel.foreground_color = span.foreground;
+      if (span.background != Color::Default)
+        pixel.background_color = span.background;
+      pixel.bold |= span.bold;
+      pixel.dim |= span.dim;
+      pixel.inverted |= span.inverted;
+      pixel.underlined |= span.underlined;
+      pixel.blink |= span.blink;
+      x += glyph.width;
+    }
+    return x;
+  }
+
+  std::vector<Span> spans_;
+  bool wrap_;
+  std::vector<Glyph> glyphs_;
+  std::vector<Segment> segments_;
+  int width_ = 0;
+};
+
+}  // namespace
+
+/// @brief Display a line made of several runs of text, each with its own
+/// style. This is a single element, cheaper than an hbox of decorated text.
+/// @param runs The pieces of text and their style.
+/// @ingroup dom
+/// @see Span
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = spans({
+///     {L"[ERROR] ", Color::Red, Color::Default, /*bold=*/true},
+///     {L"disk is full"},
+/// });
+/// ```
+Element spans(std::vector<Span> runs) {
+  return std::make_shared<Spans>(std::move(runs), false);
+}
+
+/// @brief Same as spans(), wrapping the text at spaces and line breaks over as
+/// many lines as the box allows. Like hflow, it takes all the space given.
+/// @param runs The pieces of text and their style.
+/// @ingroup dom
+/// @see spans
+Element spans_wrapped(std::vector<Span> runs) {
+  return std::make_shared<Spans>(std::move(runs), true);
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,71 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator, basic_string, string
+
+#include "ftxui/dom/elements.hpp"   // for spans, spans_wrapped, Span, bold
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/box.hpp"     // for ftxui
+#include "ftxui/screen/color.hpp"   // for Color, Color::Red
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(SpansTest, Basic) {
+  auto element = spans({
+      {L"[E] ", Color::Red},
+      {L"full"},
+  });
+  Screen screen(10, 1);
+  Render(screen, element);
+  EXPECT_EQ(
+      "\x1B[31m\x1B[49m[E] \x1B[39m\x1B[49mfull  ",
+      screen.ToString());
+}
+
+TEST(SpansTest, InheritStyle) {
+  Span highlighted;
+  highlighted.text = L"b";
+  highlighted.underlined = true;
+  auto element = spans({{L"a"}, highlighted}) | bold;
+  Screen screen(2, 1);
+  Render(screen, element);
+  EXPECT_EQ("\x1B[1ma\x1B[4mb\x1B[22m\x1B[24m", screen.ToString());
+}
+
+TEST(SpansTest, Wrapped) {
+  auto element = spans_wrapped({
+      {L"hello "},
+      {L"wor"},
+      {L"ld\nfoo bar"},
+  });
+  Screen screen(7, 4);
+  Render(screen, element);
+  EXPECT_EQ(
+      "hello  \r\n"
+      "world  \r\n"
+      "foo bar\r\n"
+      "       ",
+      screen.ToString());
+}
+
+TEST(SpansTest, WrappedClipped) {
+  auto element = spans_wrapped({{L"aa bb cc dd"}});
+  Screen screen(5, 2);
+  Render(screen, element);
+  EXPECT_EQ(
+      "aa bb\r\n"
+      "cc dd",
+      screen.ToString());
+
+  Screen small(3, 2);
+  Render(small, element);
+  EXPECT_EQ(
+      "aa \r\n"
+      "bb ",
+      small.ToString());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,163 @@
+#include <algorithm>  // for max, min, minmax_element
+#include <memory>     // for make_shared, shared_ptr
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"         // for Element, sparkline, streaming_graph
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/requirement.hpp"      // for Requirement
+#include "ftxui/dom/sample_buffer.hpp"    // for SampleBuffer
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/screen.hpp"        // for Screen, RowWriter
+
+namespace ftxui {
+
+namespace {
+
+// Microsoft's terminals often use fonts not handling the 8 unicode characters
+// for representing the blocks. Fallback with less.
+#if defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+const wchar_t sparkline_charset[] = L" ▄▄▄▄████";
+const wchar_t graph_charset[] = L"  █ █████";
+#else
+const wchar_t sparkline_charset[] = L" ▁▂▃▄▅▆▇█";
+const wchar_t graph_charset[] = L" ▗▐▖▄▟▌▙█";
+#endif
+
+// Copy the |count| last samples of |buffer|, then scale them to [0, 1], from
+// their minimum to their maximum. The copy is reused by the next frames.
+const std::vector<float>& Scaled(const SampleBuffer& buffer, size_t count) {
+  thread_local std::vector<float> samples;
+  buffer.Snapshot(count, &samples);
+  if (samples.empty())
+    return samples;
+
+  auto minmax = std::minmax_element(samples.begin(), samples.end());
+  const float min = *minmax.first;
+  const float range = *minmax.second - min;
+  for (float& sample : samples)
+    sample = range > 0.f ? (sample - min) / range : 0.5f;
+  return samples;
+}
+
+// The base of the streaming elements. Two frames displaying the same buffer
+// are identical when no sample has been pushed in between.
+class SampleView : public Node {
+ public:
+  SampleView(std::shared_ptr<SampleBuffer> buffer)
+      : buffer_(std::move(buffer)) {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.AddPointer(buffer_.get());
+    hash.Add(buffer_->pushed());
+    return HashChildren(hash);
+  }
+
+ protected:
+  std::shared_ptr<SampleBuffer> buffer_;
+};
+
+// A sample per column, on a single row.
+class Sparkline : public SampleView {
+ public:
+  using SampleView::SampleView;
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_shrink_x = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const int width = box_.x_max - box_.x_min + 1;
+    const std::vector<float>& samples = Scaled(*buffer_, width);
+
+    // The last sample is on the right.
+    const int x_first = box_.x_max + 1 - int(samples.size());
+    RowWriter row(screen, box_.y_min, x_first, box_.x_max);
+    for (int x = row.x_min(); x <= row.x_max(); ++x)
+      row.at(x) = sparkline_charset[1 + int(samples[x - x_first] * 7 + 0.5f)];
+  }
+};
+
+// Two samples per column, drawn like graph().
+class StreamingGraph : public SampleView {
+ public:
+  using SampleView::SampleView;
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 3;
+    requirement_.min_y = 3;
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    const int width = (box_.x_max - box_.x_min + 1) * 2;
+    const int height = (box_.y_max - box_.y_min + 1) * 2;
+    const std::vector<float>& samples = Scaled(*buffer_, width);
+
+    // The last sample is on the right. The missing ones are empty.
+    const int missing = width - int(samples.size());
+    auto level = [&](int i) {
+      return i < missing ? 0 : int(samples[i - missing] * height + 0.5f);
+    };
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      int yy = 2 * y;
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        int i = 2 * (x - box_.x_min);
+        int height_1 = 2 * box_.y_max + 2 - level(i);
+        int height_2 = 2 * box_.y_max + 2 - level(i + 1);
+        int i_1 = yy + 1 < height_1 ? 0 : yy + 1 == height_1 ? 3 : 6;
+        int i_2 = yy + 1 < height_2 ? 0 : yy + 1 == height_2 ? 1 : 2;
+        row.at(x) = graph_charset[i_1 + i_2];
+      }
+    }
+  }
+};
+
+}  // namespace
+
+/// @brief Draw the last samples of |buffer| on a single row, one per column.
+/// @param buffer The samples, pushed by any thread.
+/// @ingroup dom
+/// @see SampleBuffer
+///
+/// The samples are scaled from their minimum to their maximum.
+///
+/// ### Example
+///
+/// ```cpp
+/// hbox({text(L"cpu "), sparkline(cpu_samples)});
+/// ```
+///
+/// ### Output
+///
+/// ```bash
+/// cpu ▁▂▄▇█▅▃▂▁▁▂
+/// ```
+Element sparkline(std::shared_ptr<SampleBuffer> buffer) {
+  return std::make_shared<Sparkline>(std::move(buffer));
+}
+
+/// @brief Draw the last samples of |buffer| like graph(), two per column.
+/// @param buffer The samples, pushed by any thread.
+/// @ingroup dom
+/// @see SampleBuffer
+///
+/// The samples are scaled from their minimum to their maximum, over the whole
+/// height.
+Element streaming_graph(std::shared_ptr<SampleBuffer> buffer) {
+  return std::make_shared<StreamingGraph>(std::move(buffer));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
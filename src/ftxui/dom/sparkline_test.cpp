@@ -0,0 +1,68 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared
+#include <string>                   // for allocator
+
+#include "ftxui/dom/elements.hpp"         // for sparkline, streaming_graph
+#include "ftxui/dom/node.hpp"             // for Render
+#include "ftxui/dom/sample_buffer.hpp"    // for SampleBuffer
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/screen.hpp"        // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(SparklineTest, Basic) {
+  auto buffer = std::make_shared<SampleBuffer>(64);
+  for (float sample : {0, 1, 2, 3, 4, 5, 6, 7})
+    buffer->Push(sample);
+
+  Screen screen(10, 1);
+  Render(screen, sparkline(buffer));
+  EXPECT_EQ("  ▁▂▃▄▅▆▇█", screen.ToString());
+
+  // Only the last samples fit.
+  Screen small(4, 1);
+  Render(small, sparkline(buffer));
+  EXPECT_EQ("▁▃▆█", small.ToString());
+}
+
+TEST(SparklineTest, Constant) {
+  auto buffer = std::make_shared<SampleBuffer>(4);
+  for (int i = 0; i < 3; ++i)
+    buffer->Push(42);
+
+  Screen screen(3, 1);
+  Render(screen, sparkline(buffer));
+  EXPECT_EQ("▅▅▅", screen.ToString());
+}
+
+TEST(SparklineTest, StreamingGraph) {
+  auto buffer = std::make_shared<SampleBuffer>(64);
+  for (float sample : {0, 1, 2, 3})
+    buffer->Push(sample);
+
+  Screen screen(3, 2);
+  Render(screen, streaming_graph(buffer));
+  EXPECT_EQ(
+      "  ▟\r\n"
+      " ▗█",
+      screen.ToString());
+}
+
+TEST(SparklineTest, HashChangesWithSamples) {
+  auto buffer = std::make_shared<SampleBuffer>(4);
+  auto hash_of = [&] {
+    StructuralHash hash;
+    EXPECT_TRUE(sparkline(buffer)->Hash(hash));
+    return hash.value();
+  };
+  auto before = hash_of();
+  EXPECT_EQ(before, hash_of());
+  buffer->Push(1);
+  EXPECT_NE(before, hash_of());
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
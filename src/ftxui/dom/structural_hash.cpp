@@ -0,0 +1,50 @@
+#include <stdint.h>    // for uint64_t, uint32_t, uintptr_t
+#include <string.h>    // for memcpy
+#include <functional>  // for hash
+
+#include "ftxui/dom/structural_hash.hpp"
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+namespace ftxui {
+
+void StructuralHash::Add(uint64_t value) {
+  // Mix every bit of |value| into every bit of the hash, see splitmix64.
+  value += 0x9e3779b97f4a7c15ull + (value_ << 6) + (value_ >> 2);
+  value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+  value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+  value_ ^= value ^ (value >> 31);
+}
+
+void StructuralHash::Add(const std::wstring& text) {
+  Add(std::hash<std::wstring>()(text));
+}
+
+void StructuralHash::Add(const Color& color) {
+  Add(uint64_t(color.type_) << 24 | uint64_t(color.red_) << 16 |
+      uint64_t(color.green_) << 8 | uint64_t(color.blue_));
+}
+
+void StructuralHash::Add(const Pixel& pixel) {
+  Add(pixel.character);
+  Add(pixel.background_color);
+  Add(pixel.foreground_color);
+  Add(pixel.blink << 4 | pixel.bold << 3 | pixel.dim << 2 |
+      pixel.inverted << 1 | pixel.underlined);
+}
+
+void StructuralHash::AddFloat(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  Add(bits);
+}
+
+void StructuralHash::AddPointer(const void* pointer) {
+  Add(reinterpret_cast<uintptr_t>(pointer));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,88 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <stdint.h>                 // for uint64_t
+#include <string>                   // for wstring
+#include <vector>                   // for vector
+
+#include "ftxui/dom/elements.hpp"  // for text, operator|, Element, border, vbox, hbox, gauge, color, bold, reflect, graph, gridbox, size
+#include "ftxui/dom/node.hpp"             // for Node
+#include "ftxui/dom/reconciler.hpp"       // for Reconciler
+#include "ftxui/dom/structural_hash.hpp"  // for StructuralHash
+#include "ftxui/screen/box.hpp"           // for Box
+#include "ftxui/screen/color.hpp"         // for Color
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+uint64_t HashOf(Element element) {
+  StructuralHash hash;
+  EXPECT_TRUE(element->Hash(hash));
+  return hash.value();
+}
+
+Element Document(std::wstring label, float progress, Color c) {
+  return vbox({
+      text(label) | bold | color(c),
+      hbox({text(L"progress"), gauge(progress) | flex}),
+      gridbox({{text(L"a"), text(L"b")}, {text(L"c")}}),
+  }) | border;
+}
+
+}  // namespace
+
+TEST(StructuralHashTest, SameDocument) {
+  EXPECT_EQ(HashOf(Document(L"label", 0.5f, Color::Red)),
+            HashOf(Document(L"label", 0.5f, Color::Red)));
+}
+
+TEST(StructuralHashTest, DifferentContent) {
+  uint64_t reference = HashOf(Document(L"label", 0.5f, Color::Red));
+  EXPECT_NE(reference, HashOf(Document(L"Label", 0.5f, Color::Red)));
+  EXPECT_NE(reference, HashOf(Document(L"label", 0.6f, Color::Red)));
+  EXPECT_NE(reference, HashOf(Document(L"label", 0.5f, Color::Blue)));
+}
+
+TEST(StructuralHashTest, DifferentStructure) {
+  EXPECT_NE(HashOf(hbox({text(L"a"), text(L"b")})),
+            HashOf(vbox({text(L"a"), text(L"b")})));
+  EXPECT_NE(HashOf(hbox({text(L"ab")})),
+            HashOf(hbox({text(L"a"), text(L"b")})));
+  EXPECT_NE(HashOf(text(L"a") | flex), HashOf(text(L"a") | xflex));
+  EXPECT_NE(HashOf(text(L"a") | size(WIDTH, EQUAL, 3)),
+            HashOf(text(L"a") | size(WIDTH, EQUAL, 4)));
+  EXPECT_NE(HashOf(gridbox({{text(L"a"), text(L"b")}})),
+            HashOf(gridbox({{text(L"a")}, {text(L"b")}})));
+}
+
+TEST(StructuralHashTest, Reflect) {
+  Box box_1;
+  Box box_2;
+  EXPECT_EQ(HashOf(text(L"a") | reflect(box_1)),
+            HashOf(text(L"a") | reflect(box_1)));
+  EXPECT_NE(HashOf(text(L"a") | reflect(box_1)),
+            HashOf(text(L"a") | reflect(box_2)));
+}
+
+TEST(StructuralHashTest, Keyed) {
+  Reconciler reconciler;
+  auto keyed = [&](std::wstring label, size_t version) {
+    return reconciler.Keyed("key", version, [&] { return text(label); });
+  };
+  uint64_t hash = HashOf(keyed(L"a", 1));
+  EXPECT_EQ(hash, HashOf(keyed(L"a", 1)));
+  EXPECT_NE(hash, HashOf(keyed(L"b", 2)));
+}
+
+TEST(StructuralHashTest, Unhashable) {
+  auto graph_function = [](int width, int) {
+    return std::vector<int>(width, 0);
+  };
+  StructuralHash hash;
+  EXPECT_FALSE(vbox({text(L"a"), graph(graph_function)})->Hash(hash));
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,125 @@
+#include <memory>   // for make_shared, shared_ptr
+#include <utility>  // for move
+
+#include "ftxui/dom/elements.hpp"        // for Element
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/style.hpp"
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen, RowWriter
+
+namespace ftxui {
+namespace style {
+
+namespace {
+
+// Bold and the colors are drawn before the children, so that the children can
+// override them. The other attributes are drawn after.
+const uint8_t kBefore = kBold;
+
+class Style : public NodeDecorator {
+ public:
+  Style(Element child) : NodeDecorator(std::move(child)) {}
+  ~Style() override {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(attributes_ | has_foreground_ << 8 | has_background_ << 9);
+    if (has_foreground_)
+      hash.Add(foreground_);
+    if (has_background_)
+      hash.Add(background_);
+    return HashChildren(hash);
+  }
+
+  void Render(Screen& screen) override {
+    if ((attributes_ & kBefore) || has_foreground_ || has_background_)
+      RenderBefore(screen);
+    Node::Render(screen);
+    if (attributes_ & ~kBefore)
+      RenderAfter(screen);
+  }
+
+  void RenderBefore(Screen& screen) {
+    bool bold = attributes_ & kBold;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        Pixel& pixel = row.PixelAt(x);
+        if (bold)
+          pixel.bold = true;
+        if (has_foreground_)
+          pixel.foreground_color = foreground_;
+        if (has_background_)
+          pixel.background_color = background_;
+      }
+    }
+  }
+
+  void RenderAfter(Screen& screen) {
+    bool dim = attributes_ & kDim;
+    bool inverted = attributes_ & kInverted;
+    bool underlined = attributes_ & kUnderlined;
+    bool blink = attributes_ & kBlink;
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      RowWriter row(screen, y, box_.x_min, box_.x_max);
+      for (int x = row.x_min(); x <= row.x_max(); ++x) {
+        Pixel& pixel = row.PixelAt(x);
+        pixel.dim |= dim;
+        pixel.inverted |= inverted;
+        pixel.underlined |= underlined;
+        pixel.blink |= blink;
+      }
+    }
+  }
+
+  uint8_t attributes_ = 0;
+  bool has_foreground_ = false;
+  bool has_background_ = false;
+  Color foreground_;
+  Color background_;
+};
+
+// Return the style node |child| can be merged into, or a new one wrapping it.
+// An element referenced from somewhere else can't be modified, because the
+// style would leak into the other places.
+std::shared_ptr<Style> Merge(Element child) {
+  if (child.use_count() == 1) {
+    if (auto style = std::dynamic_pointer_cast<Style>(child))
+      return style;
+  }
+  return std::make_shared<Style>(std::move(child));
+}
+
+}  // namespace
+
+Element Apply(Element child, uint8_t attributes) {
+  auto style = Merge(std::move(child));
+  style->attributes_ |= attributes;
+  return style;
+}
+
+// The colors of the child take precedence over the colors of its parent. When
+// merging, an outer color only applies when no inner one was already set.
+Element ApplyForeground(Element child, Color color) {
+  auto style = Merge(std::move(child));
+  if (!style->has_foreground_) {
+    style->has_foreground_ = true;
+    style->foreground_ = color;
+  }
+  return style;
+}
+
+Element ApplyBackground(Element child, Color color) {
+  auto style = Merge(std::move(child));
+  if (!style->has_background_) {
+    style->has_background_ = true;
+    style->background_ = color;
+  }
+  return style;
+}
+
+}  // namespace style
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,35 @@
+#ifndef FTXUI_DOM_STYLE_HPP
+#define FTXUI_DOM_STYLE_HPP
+
+#include <stdint.h>  // for uint8_t
+
+#include "ftxui/dom/node.hpp"      // for Element
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+// The style decorators (bold, dim, color, ...) all produce the same node type.
+// Applying one of them to an element already being a style node merges them
+// into a single node, drawing the whole style in one pass over its pixels.
+namespace style {
+
+enum Attribute : uint8_t {
+  kBold = 1 << 0,
+  kDim = 1 << 1,
+  kInverted = 1 << 2,
+  kUnderlined = 1 << 3,
+  kBlink = 1 << 4,
+};
+
+Element Apply(Element child, uint8_t attributes);
+Element ApplyForeground(Element child, Color color);
+Element ApplyBackground(Element child, Color color);
+
+}  // namespace style
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_STYLE_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
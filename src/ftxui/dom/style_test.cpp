@@ -0,0 +1,51 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator, basic_string, string
+
+#include "ftxui/dom/elements.hpp"   // for text, operator|, bold, dim, color
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/box.hpp"     // for ftxui
+#include "ftxui/screen/color.hpp"   // for Color, Color::Blue, Color::Red
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+std::string Print(Element element) {
+  Screen screen(1, 1);
+  Render(screen, element);
+  return screen.ToString();
+}
+}  // namespace
+
+TEST(StyleTest, Stacked) {
+  EXPECT_EQ(
+      "\x1B[1m\x1B[2m\x1B[4m"
+      "a"
+      "\x1B[22m\x1B[22m\x1B[24m",
+      Print(text(L"a") | underlined | dim | bold));
+}
+
+TEST(StyleTest, InnerColorWins) {
+  EXPECT_EQ(
+      "\x1B[31m\x1B[49m"
+      "a"
+      "\x1B[39m\x1B[49m",
+      Print(text(L"a") | color(Color::Red) | color(Color::Blue)));
+}
+
+TEST(StyleTest, SharedElementIsNotModified) {
+  auto shared = text(L"a") | bold;
+  auto styled = shared | color(Color::Red);
+  EXPECT_EQ("\x1B[1ma\x1B[22m", Print(shared));
+  EXPECT_EQ(
+      "\x1B[1m\x1B[31m\x1B[49m"
+      "a"
+      "\x1B[22m\x1B[39m\x1B[49m",
+      Print(styled));
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,61 @@
+#include <algorithm>  // for max
+#include <climits>    // for INT_MIN
+
+#include "ftxui/dom/sub_screen.hpp"
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel, RowWriter
+
+namespace ftxui {
+
+const Screen::Cursor kNoCursor = {INT_MIN, INT_MIN};
+
+bool HasCursor(const Screen& screen) {
+  return screen.cursor().x != kNoCursor.x || screen.cursor().y != kNoCursor.y;
+}
+
+SubScreen::SubScreen(Box area)
+    : Screen(std::max(0, area.x_max - area.x_min + 1),
+             std::max(0, area.y_max - area.y_min + 1)),
+      area_(area) {
+  origin_x_ = area.x_min;
+  origin_y_ = area.y_min;
+  stencil = area;
+}
+
+void SubScreen::CopyFrom(Screen& screen) {
+  // The cells outside of the stencil of |screen| are blank.
+  for (int y = 0; y < dimy_; ++y) {
+    RowWriter row(screen, y + origin_y_, origin_x_, origin_x_ + dimx_ - 1);
+    for (int x = 0; x < dimx_; ++x) {
+      pixels_[y][x] =
+          row.Contain(x + origin_x_) ? row.PixelAt(x + origin_x_) : Pixel();
+    }
+  }
+}
+
+void SubScreen::CopyTo(Screen& screen) {
+  Box area = Box::Intersection(area_, screen.stencil);
+  for (int y = area.y_min; y <= area.y_max; ++y) {
+    RowWriter row(screen, y, area.x_min, area.x_max);
+    const auto& source = pixels_[y - origin_y_];
+    for (int x = row.x_min(); x <= row.x_max(); ++x)
+      row.PixelAt(x) = source[x - origin_x_];
+  }
+}
+
+void SubScreen::MoveTo(int x, int y) {
+  const int dx = x - area_.x_min;
+  const int dy = y - area_.y_min;
+  area_ = {area_.x_min + dx, area_.x_max + dx, area_.y_min + dy,
+           area_.y_max + dy};
+  stencil = {stencil.x_min + dx, stencil.x_max + dx, stencil.y_min + dy,
+             stencil.y_max + dy};
+  origin_x_ = x;
+  origin_y_ = y;
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
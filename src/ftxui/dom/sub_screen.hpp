@@ -0,0 +1,41 @@
+#ifndef FTXUI_DOM_SUB_SCREEN_HPP
+#define FTXUI_DOM_SUB_SCREEN_HPP
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+// The cursor of a screen before anything is drawn. Drawing over it tells
+// whether the cursor was set.
+extern const Screen::Cursor kNoCursor;
+
+// Whether the cursor of |screen| was set since it was |kNoCursor|.
+bool HasCursor(const Screen& screen);
+
+// A Screen holding only the pixels of |area|. Nodes draw into it using the
+// same coordinates as for the full screen.
+class SubScreen : public Screen {
+ public:
+  SubScreen(Box area);
+
+  // Copy the pixels of |area| from |screen|.
+  void CopyFrom(Screen& screen);
+
+  // Copy the pixels of |area| into |screen|, clipped by its stencil.
+  void CopyTo(Screen& screen);
+
+  // Translate |area| so that it starts at (x, y), keeping the pixels.
+  void MoveTo(int x, int y);
+
+ private:
+  Box area_;
+};
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_SUB_SCREEN_HPP */
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
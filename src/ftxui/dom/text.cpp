@@ -1,58 +1,112 @@
 #include <algorithm>  // for max
 #include <memory>     // for make_shared
 #include <string>     // for wstring
+#include <utility>    // for move
 
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen
-#include "ftxui/screen/string.hpp"    // for wchar_width, wstring_width
+#include "ftxui/dom/elements.hpp"            // for Element, text, vtext
+#include "ftxui/dom/node.hpp"                // for Node
+#include "ftxui/dom/requirement.hpp"         // for Requirement
+#include "ftxui/screen/box.hpp"              // for Box
+#include "ftxui/screen/interned_string.hpp"  // for InternedString
+#include "ftxui/screen/screen.hpp"           // for Screen, RowWriter
+#include "ftxui/screen/string.hpp"           // for wchar_width, wstring_width
 
 namespace ftxui {
 
 using ftxui::Screen;
 
+namespace {
+
+// Draw |text| on the first line of |box|, from the column |x|. Return the
+// column after it.
+int RenderLine(Screen& screen,
+               const Box& box,
+               const std::wstring& text,
+               int x) {
+  if (box.y_min > box.y_max)
+    return x;
+  RowWriter row(screen, box.y_min, box.x_min, box.x_max);
+  for (wchar_t c : text) {
+    const int width = wchar_width(c);
+    if (width >= 1) {
+      if (x > row.x_max())
+        return x;
+      if (row.Contain(x))
+        row.PixelAt(x).character = c;
+    } else if (row.Contain(x - 1)) {
+      row.PixelAt(x - 1).character += c;
+    }
+    x += std::max(width, 0);
+  }
+  return x;
+}
+
+}  // namespace
+
 class Text : public Node {
  public:
-  Text(std::wstring text) : Node(), text_(text) {}
+  Text(std::wstring text) : Node(), text_(std::move(text)) {}
   ~Text() {}
 
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(text_);
+    return HashChildren(hash);
+  }
+
   void ComputeRequirement() override {
     requirement_.min_x = wstring_width(text_);
     requirement_.min_y = 1;
   }
 
   void Render(Screen& screen) override {
-    int x = box_.x_min;
-    int y = box_.y_min;
-    if (y > box_.y_max)
-      return;
-    for (wchar_t c : text_) {
-      const int width = wchar_width(c);
-      if (width >= 1) {
-        if (x > box_.x_max)
-          return;
-        screen.PixelAt(x, y).character = c;
-      } else {
-        screen.PixelAt(x - 1, y).character += c;
-      }
-      x += std::max(width, 0);
-    }
+    RenderLine(screen, box_, text_, box_.x_min);
   }
 
  private:
   std::wstring text_;
 };
 
+// Draw |prefix|, often empty, then |text|.
+class InternedText : public Node {
+ public:
+  InternedText(InternedString prefix, InternedString text)
+      : Node(), prefix_(std::move(prefix)), text_(std::move(text)) {}
+  ~InternedText() {}
+
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(prefix_.str());
+    hash.Add(text_.str());
+    return HashChildren(hash);
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = prefix_.width() + text_.width();
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    int x = RenderLine(screen, box_, prefix_.str(), box_.x_min);
+    RenderLine(screen, box_, text_.str(), x);
+  }
+
+ private:
+  InternedString prefix_;
+  InternedString text_;
+};
+
 class VText : public Node {
  public:
-  VText(std::wstring text) : Node(), text_(text) {
+  VText(std::wstring text) : Node(), text_(std::move(text)) {
     for (auto& c : text_)
       width_ = std::max(width_, wchar_width(c));
   }
   ~VText() {}
 
+  bool Hash(StructuralHash& hash) override {
+    hash.Add(text_);
+    return HashChildren(hash);
+  }
+
   void ComputeRequirement() override {
     requirement_.min_x = width_;
     requirement_.min_y = text_.size();
@@ -66,7 +120,9 @@ class VText : public Node {
     for (wchar_t c : text_) {
       if (y > box_.y_max)
         return;
-      screen.at(x, y) = c;
+      RowWriter row(screen, y, x, x);
+      if (row.Contain(x))
+        row.at(x) = c;
       y += 1;
     }
   }
@@ -92,7 +148,37 @@ class VText : public Node {
 /// Hello world!
 /// ```
 Element text(std::wstring text) {
-  return std::make_shared<Text>(text);
+  return std::make_shared<Text>(std::move(text));
+}
+
+/// @brief Display a piece of interned unicode text. The text isn't copied, nor
+/// measured again.
+/// @ingroup dom
+/// @see InternedString
+///
+/// ### Example
+///
+/// ```cpp
+/// InternedString ok = std::wstring(L"OK");
+/// Element document = hbox({text(ok), text(ok)});
+/// ```
+Element text(InternedString text) {
+  return std::make_shared<InternedText>(InternedString(), std::move(text));
+}
+
+/// @brief Display two pieces of interned unicode text, one after the other, as
+/// a single element. Neither is copied.
+/// @ingroup dom
+/// @see InternedString
+///
+/// ### Example
+///
+/// ```cpp
+/// InternedString icon = std::wstring(L"> ");
+/// Element entry = text(icon, label);
+/// ```
+Element text(InternedString prefix, InternedString text) {
+  return std::make_shared<InternedText>(std::move(prefix), std::move(text));
 }
 
 /// @brief Display a pieve of unicode text vertically.
@@ -122,7 +208,7 @@ Element text(std::wstring text) {
 /// !
 /// ```
 Element vtext(std::wstring text) {
-  return std::make_shared<VText>(text);
+  return std::make_shared<VText>(std::move(text));
 }
 
 }  // namespace ftxui
@@ -104,6 +104,31 @@ TEST(TextTest, CombiningCharacters) {
   EXPECT_EQ(to_string(t), screen.ToString());
 }
 
+TEST(TextTest, InternedString) {
+  InternedString label = std::wstring(L"测试");
+  auto element = hbox({text(label), text(label)}) | border;
+  Screen screen(6, 3);
+  Render(screen, element);
+  EXPECT_EQ(
+      "┌────┐\r\n"
+      "│测测│\r\n"
+      "└────┘",
+      screen.ToString());
+}
+
+TEST(TextTest, InternedPrefix) {
+  InternedString prefix = std::wstring(L"> ");
+  InternedString label = std::wstring(L"测试");
+  auto element = text(prefix, label) | border;
+  Screen screen(8, 3);
+  Render(screen, element);
+  EXPECT_EQ(
+      "┌──────┐\r\n"
+      "│> 测试│\r\n"
+      "└──────┘",
+      screen.ToString());
+}
+
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
@@ -1,6 +1,7 @@
 #include <gtest/gtest-message.h>    // for Message
 #include <gtest/gtest-test-part.h>  // for TestPartResult
 #include <algorithm>                // for remove
+#include <memory>                   // for make_shared
 #include <string>                   // for allocator, basic_string, string
 #include <vector>                   // for vector
 
@@ -364,6 +365,82 @@ TEST(VBoxText, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+namespace {
+class RenderCounter : public Node {
+ public:
+  RenderCounter(int* count, int height = 1) : count_(count), height_(height) {}
+  void ComputeRequirement() override { requirement_.min_y = height_; }
+  void Render(Screen&) override { (*count_)++; }
+
+ private:
+  int* count_;
+  int height_;
+};
+
+// Its SetBox() doesn't call Node::SetBox().
+class UnknownBox : public RenderCounter {
+ public:
+  using RenderCounter::RenderCounter;
+  void SetBox(Box) override {}
+};
+}  // namespace
+
+TEST(VBoxText, SkipChildrenOutsideTheScreen) {
+  int count = 0;
+  Elements children;
+  for (int i = 0; i < 100; ++i)
+    children.push_back(std::make_shared<RenderCounter>(&count));
+  auto root = vbox(std::move(children));
+
+  Screen screen(1, 10);
+  Render(screen, root);
+  EXPECT_EQ(count, 10);
+}
+
+TEST(VBoxText, SkipChildrenOutsideTheFrame) {
+  int count = 0;
+  Elements children;
+  for (int i = 0; i < 100000; ++i) {
+    auto line = text(std::to_wstring(i));
+    if (i == 50000)
+      line = line | focus;
+    children.push_back(line);
+    // Empty children share their position with the next one.
+    children.push_back(std::make_shared<RenderCounter>(&count, 0));
+  }
+  auto root = vbox(std::move(children)) | yframe;
+
+  Screen screen(5, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "49999\r\n"
+            "50000\r\n"
+            "50001");
+  EXPECT_LE(count, 4);
+}
+
+// The children can't be searched by their box when one isn't known.
+TEST(VBoxText, DrawChildrenWithUnknownBox) {
+  int count = 0;
+  Elements children;
+  children.push_back(std::make_shared<UnknownBox>(&count, 0));
+  for (int i = 0; i < 100; ++i) {
+    auto line = text(std::to_wstring(i));
+    if (i == 50)
+      line = line | focus;
+    children.push_back(line);
+  }
+  auto root = vbox(std::move(children)) | yframe;
+
+  Screen screen(2, 3);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "49\r\n"
+            "50\r\n"
+            "51");
+  EXPECT_EQ(count, 1);
+}
+
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
@@ -0,0 +1,206 @@
+#include <algorithm>   // for max, min
+#include <functional>  // for function
+#include <memory>      // for make_shared
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include "ftxui/dom/elements.hpp"     // for Element, VGridOption, vgrid
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/parallel.hpp"     // for RenderDisjoint
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+// A row or a column displayed.
+struct Track {
+  int index;
+  int position = 0;
+  int size = 0;  // Zero until measured.
+};
+
+// The tracks possibly visible in |extent| cells: the frozen ones, then the
+// ones from |first|. Every track is at least one cell large.
+std::vector<Track> Candidates(int count, int frozen, int first, int extent) {
+  std::vector<Track> tracks;
+  frozen = std::min(frozen, count);
+  for (int i = 0; i < frozen && int(tracks.size()) < extent; ++i)
+    tracks.push_back({i});
+  for (int i = std::max(first, frozen); i < count; ++i) {
+    if (int(tracks.size()) >= extent)
+      break;
+    tracks.push_back({i});
+  }
+  return tracks;
+}
+
+// Place the tracks one after the other, and drop the ones past |extent|.
+void Place(std::vector<Track>* tracks, int extent) {
+  int position = 0;
+  for (size_t i = 0; i < tracks->size(); ++i) {
+    if (position >= extent) {
+      tracks->resize(i);
+      return;
+    }
+    (*tracks)[i].position = position;
+    position += (*tracks)[i].size;
+  }
+}
+
+}  // namespace
+
+class VGrid : public Node {
+ public:
+  VGrid(int rows,
+        int columns,
+        std::function<Element(int, int)> cell,
+        VGridOption option)
+      : rows_(rows),
+        columns_(columns),
+        cell_(std::move(cell)),
+        option_(std::move(option)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+  }
+
+  void SetBox(Box box) override {
+    if (built_ && box == box_)
+      return;
+    Node::SetBox(box);
+    built_ = true;
+
+    const int width = box.x_max - box.x_min + 1;
+    const int height = box.y_max - box.y_min + 1;
+    std::vector<Track> rows =
+        Candidates(rows_, option_.frozen_rows, option_.top, height);
+    std::vector<Track> columns =
+        Candidates(columns_, option_.frozen_columns, option_.left, width);
+
+    // The fixed tracks are placed first, so that only the cells possibly
+    // visible are built.
+    if (option_.row_height) {
+      for (Track& row : rows)
+        row.size = std::max(1, option_.row_height(row.index));
+      Place(&rows, height);
+    }
+    if (option_.column_width) {
+      for (Track& column : columns)
+        column.size = std::max(1, option_.column_width(column.index));
+      Place(&columns, width);
+    }
+
+    const size_t stride = columns.size();
+    std::vector<Element> cells;
+    cells.reserve(rows.size() * stride);
+    for (const Track& row : rows) {
+      for (const Track& column : columns) {
+        cells.push_back(cell_(row.index, column.index));
+        cells.back()->ComputeRequirement();
+      }
+    }
+
+    // The other tracks are measured from their cells.
+    if (!option_.row_height) {
+      for (size_t y = 0; y < rows.size(); ++y) {
+        rows[y].size = 1;
+        for (size_t x = 0; x < stride; ++x) {
+          rows[y].size = std::max(rows[y].size,
+                                  cells[y * stride + x]->requirement().min_y);
+        }
+      }
+      Place(&rows, height);
+    }
+    if (!option_.column_width) {
+      for (size_t x = 0; x < stride; ++x) {
+        columns[x].size = 1;
+        for (size_t y = 0; y < rows.size(); ++y) {
+          columns[x].size = std::max(
+              columns[x].size, cells[y * stride + x]->requirement().min_x);
+        }
+      }
+      Place(&columns, width);
+    }
+
+    children_.clear();
+    children_.reserve(rows.size() * columns.size());
+    for (size_t y = 0; y < rows.size(); ++y) {
+      for (size_t x = 0; x < columns.size(); ++x) {
+        Element& cell = cells[y * stride + x];
+        Box cell_box;
+        cell_box.x_min = box.x_min + columns[x].position;
+        cell_box.x_max = cell_box.x_min + columns[x].size - 1;
+        cell_box.y_min = box.y_min + rows[y].position;
+        cell_box.y_max = cell_box.y_min + rows[y].size - 1;
+        cell->SetBox(cell_box);
+        children_.push_back(std::move(cell));
+      }
+    }
+  }
+
+  // The last tracks may overflow the box. They are clipped.
+  void Render(Screen& screen) override {
+    AutoReset<Box> stencil(&screen.stencil,
+                           Box::Intersection(box_, screen.stencil));
+    RenderDisjoint(screen, children_);
+  }
+
+  bool CullsByStencil() const override { return true; }
+
+ private:
+  int rows_;
+  int columns_;
+  std::function<Element(int, int)> cell_;
+  VGridOption option_;
+  bool built_ = false;
+};
+
+/// @brief A grid of |rows| x |columns| cells, built on demand. Only the cells
+/// visible are built, so its cost doesn't depend on its size.
+/// @param rows The number of rows.
+/// @param columns The number of columns.
+/// @param cell Build the cell at a row and a column.
+/// @param option The size of the tracks, the frozen ones, and the scrolling.
+/// @ingroup dom
+///
+/// The grid fills the space it is given. It is scrolled by |option.top| and
+/// |option.left|. The frozen rows and columns stay on the top and on the left.
+///
+/// The size of a track is either fixed, or measured from the cells of the
+/// track which may be visible. The rows are one cell high by default, and the
+/// columns are measured.
+///
+/// ### Example
+///
+/// ```cpp
+/// VGridOption option;
+/// option.frozen_rows = 1;
+/// option.top = scroll;
+/// vgrid(table.rows() + 1, table.columns(), [&](int row, int column) {
+///   if (row == 0)
+///     return text(table.header(column)) | bold;
+///   return text(table.cell(row - 1, column));
+/// }, option);
+/// ```
+Element vgrid(int rows,
+              int columns,
+              std::function<Element(int row, int column)> cell,
+              VGridOption option) {
+  return std::make_shared<VGrid>(rows, columns, std::move(cell),
+                                 std::move(option));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
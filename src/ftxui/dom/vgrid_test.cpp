@@ -0,0 +1,87 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator, to_wstring, string
+
+#include "ftxui/dom/elements.hpp"   // for text, vgrid, Element, VGridOption
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+const int kHuge = 1000000000;
+}  // namespace
+
+TEST(VGridTest, OnlyVisibleCellsAreBuilt) {
+  int built = 0;
+  auto cell = [&](int row, int column) {
+    built++;
+    return text(std::to_wstring(row % 10) + std::to_wstring(column % 10));
+  };
+  VGridOption option;
+  option.column_width = [](int) { return 3; };
+  option.top = 123456789;
+  option.left = 7;
+
+  Screen screen(8, 2);
+  Render(screen, vgrid(kHuge, kHuge, cell, option));
+  EXPECT_EQ(
+      "97 98 99\r\n"
+      "07 08 09",
+      screen.ToString());
+  EXPECT_EQ(built, 6);
+}
+
+TEST(VGridTest, Frozen) {
+  auto cell = [&](int row, int column) {
+    return text(std::to_wstring(row) + std::to_wstring(column));
+  };
+  VGridOption option;
+  option.frozen_rows = 1;
+  option.frozen_columns = 1;
+  option.top = 5;
+  option.left = 3;
+
+  Screen screen(6, 3);
+  Render(screen, vgrid(100, 100, cell, option));
+  EXPECT_EQ(
+      "000304\r\n"
+      "505354\r\n"
+      "606364",
+      screen.ToString());
+}
+
+TEST(VGridTest, Measured) {
+  auto cell = [&](int row, int column) {
+    return text(std::wstring(row + column + 1, L'a' + column));
+  };
+  VGridOption option;
+  option.row_height = nullptr;
+
+  Screen screen(7, 3);
+  Render(screen, vgrid(2, 3, cell, option));
+  EXPECT_EQ(
+      "a bb cc\r\n"
+      "aabbbcc\r\n"
+      "       ",
+      screen.ToString());
+}
+
+TEST(VGridTest, ScrolledPastTheEnd) {
+  int built = 0;
+  auto cell = [&](int, int) {
+    built++;
+    return text(L"x");
+  };
+  VGridOption option;
+  option.top = 10;
+
+  Screen screen(2, 2);
+  Render(screen, vgrid(10, 10, cell, option));
+  EXPECT_EQ(built, 0);
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -24,6 +24,21 @@ bool Box::Contain(int x, int y) {
          y_max >= y;
 }
 
+/// @return whether both boxes have the same coordinates.
+/// @ingroup screen
+bool Box::operator==(const Box& other) const {
+  return x_min == other.x_min &&  //
+         x_max == other.x_max &&  //
+         y_min == other.y_min &&  //
+         y_max == other.y_max;
+}
+
+/// @return whether the boxes have different coordinates.
+/// @ingroup screen
+bool Box::operator!=(const Box& other) const {
+  return !operator==(other);
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -76,29 +76,17 @@ Color::Color(Palette256 index) : type_(ColorType::Palette256), index_(index) {
 /// @ingroup screen
 Color::Color(uint8_t red, uint8_t green, uint8_t blue)
     : type_(ColorType::TrueColor), red_(red), green_(green), blue_(blue) {
-  if (Terminal::ColorSupport() == Terminal::Color::TrueColor)
+  const Terminal::Color support = Terminal::ColorSupport();
+  if (support == Terminal::Color::TrueColor)
     return;
 
-  int closest = 256 * 256 * 3;
-  int best = 0;
-  for (int i = 16; i < 256; ++i) {
-    ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    int dr = color_info.red - red;
-    int dg = color_info.green - green;
-    int db = color_info.blue - blue;
-    int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
-
-  if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
+  const Palette256 best = ClosestPalette256(red, green, blue);
+  if (support == Terminal::Color::Palette256) {
     type_ = ColorType::Palette256;
     index_ = best;
   } else {
     type_ = ColorType::Palette16;
-    index_ = GetColorInfo(Color::Palette256(best)).index_16;
+    index_ = GetColorInfo(best).index_16;
   }
 }
 
@@ -146,6 +134,41 @@ Color Color::HSV(uint8_t h, uint8_t s, uint8_t v) {
   return Color(0, 0, 0);
 }
 
+/// @brief Mix two colors in RGB.
+/// @param t The proportion of |b| in the result [0,1].
+/// @param a The color when t = 0.
+/// @param b The color when t = 1.
+/// @ingroup screen
+///
+/// The colors of the palettes are mixed using their usual RGB values.
+/// Color::Default can't be mixed: the closest of |a| or |b| is returned.
+// static
+Color Color::Interpolate(float t, const Color& a, const Color& b) {
+  if (a.type_ == ColorType::Palette1 || b.type_ == ColorType::Palette1)
+    return t < 0.5f ? a : b;
+
+  auto rgb = [](const Color& color, int* red, int* green, int* blue) {
+    if (color.type_ == ColorType::TrueColor) {
+      *red = color.red_;
+      *green = color.green_;
+      *blue = color.blue_;
+      return;
+    }
+    ColorInfo info = GetColorInfo(Color::Palette256(color.index_));
+    *red = info.red;
+    *green = info.green;
+    *blue = info.blue;
+  };
+  int a_red, a_green, a_blue;
+  int b_red, b_green, b_blue;
+  rgb(a, &a_red, &a_green, &a_blue);
+  rgb(b, &b_red, &b_green, &b_blue);
+
+  t = t < 0.f ? 0.f : t > 1.f ? 1.f : t;
+  auto mix = [t](int x, int y) { return uint8_t(x + (y - x) * t + 0.5f); };
+  return Color(mix(a_red, b_red), mix(a_green, b_green), mix(a_blue, b_blue));
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
@@ -1,3 +1,8 @@
+#include <algorithm>  // for max, min
+#include <array>      // for array
+#include <atomic>     // for atomic
+#include <cmath>      // for cbrt, pow
+
 #include "ftxui/screen/color_info.hpp"
 #include "ftxui/screen/color.hpp"  // for Color, Color::Palette16, Color::Palette256
 
@@ -270,10 +275,139 @@ ColorInfo GetColorInfo(Color::Palette256 index) {
 ColorInfo GetColorInfo(Color::Palette16 index) {
   return palette256[int(index)];
 }
-// clang-format off
+// clang-format on
+
+namespace {
+
+std::atomic<bool> perceptual_quantization(false);
+
+struct Lab {
+  float l;
+  float a;
+  float b;
+};
+
+// https://en.wikipedia.org/wiki/CIELAB_color_space, with the D65 white.
+Lab ToLab(int red, int green, int blue) {
+  auto linear = [](int c) {
+    float v = c / 255.f;
+    return v <= 0.04045f ? v / 12.92f : std::pow((v + 0.055f) / 1.055f, 2.4f);
+  };
+  const float r = linear(red);
+  const float g = linear(green);
+  const float b = linear(blue);
+  const float x = (0.4124f * r + 0.3576f * g + 0.1805f * b) / 0.95047f;
+  const float y = (0.2126f * r + 0.7152f * g + 0.0722f * b);
+  const float z = (0.0193f * r + 0.1192f * g + 0.9505f * b) / 1.08883f;
+  auto f = [](float t) {
+    return t > 0.008856f ? std::cbrt(t) : 7.787f * t + 16.f / 116.f;
+  };
+  return {116.f * f(y) - 16.f, 500.f * (f(x) - f(y)), 200.f * (f(y) - f(z))};
+}
+
+// The palette 256 is a 6x6x6 cube of colors, followed by 24 grays. The closest
+// color in RGB is either the closest in the cube, found channel by channel, or
+// the closest gray.
+uint8_t ClosestInRGB(int red, int green, int blue) {
+  auto level = [](int c) {
+    return c < 48 ? 0 : c <= 115 ? 1 : (c - 116) / 40 + 2;
+  };
+  const int r = level(red);
+  const int g = level(green);
+  const int b = level(blue);
+  const int cube = 16 + 36 * r + 6 * g + b;
+
+  const int sum = red + green + blue;
+  const int gray = 232 + std::max(0, std::min(23, (sum - 24 + 15) / 30));
+
+  auto distance = [&](int i) {
+    const ColorInfo& info = palette256[i];
+    const int dr = info.red - red;
+    const int dg = info.green - green;
+    const int db = info.blue - blue;
+    return dr * dr + dg * dg + db * db;
+  };
+  return distance(cube) <= distance(gray) ? cube : gray;
+}
 
+// The closest color in CIELAB, for 32x32x32 bins of RGB colors. Searching
+// through the 240 colors is too slow to be done for every color, so every bin
+// stores the closest color to its center.
+class LabTable {
+ public:
+  static constexpr int kBits = 5;
+  static constexpr int kBins = 1 << kBits;
+
+  LabTable() {
+    for (int i = 16; i < 256; ++i) {
+      const ColorInfo& info = palette256[i];
+      labs_[i] = ToLab(info.red, info.green, info.blue);
+    }
+
+    // The first and the last bins are centered on 0 and 255, so that the pure
+    // colors are found exactly.
+    for (int r = 0; r < kBins; ++r) {
+      for (int g = 0; g < kBins; ++g) {
+        for (int b = 0; b < kBins; ++b) {
+          table_[(r << (2 * kBits)) | (g << kBits) | b] =
+              Search(ToLab(Center(r), Center(g), Center(b)));
+        }
+      }
+    }
+  }
+
+  uint8_t Get(uint8_t red, uint8_t green, uint8_t blue) const {
+    const int shift = 8 - kBits;
+    return table_[((red >> shift) << (2 * kBits)) |
+                  ((green >> shift) << kBits) | (blue >> shift)];
+  }
+
+ private:
+  static int Center(int bin) { return bin * 255 / (kBins - 1); }
+
+  uint8_t Search(const Lab& lab) const {
+    float closest = 1e30f;
+    int best = 16;
+    for (int i = 16; i < 256; ++i) {
+      const float dl = labs_[i].l - lab.l;
+      const float da = labs_[i].a - lab.a;
+      const float db = labs_[i].b - lab.b;
+      const float dist = dl * dl + da * da + db * db;
+      if (closest > dist) {
+        closest = dist;
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  std::array<Lab, 256> labs_;
+  std::array<uint8_t, kBins * kBins * kBins> table_;
+};
+
+}  // namespace
+
+/// @brief Return the color of the palette 256 closest to an RGB color. The 16
+/// first colors are ignored, as they depend on the terminal.
+/// @ingroup screen
+Color::Palette256 ClosestPalette256(uint8_t red, uint8_t green, uint8_t blue) {
+  if (perceptual_quantization.load(std::memory_order_relaxed)) {
+    static const LabTable table;  // Built the first time.
+    return Color::Palette256(table.Get(red, green, blue));
+  }
+  return Color::Palette256(ClosestInRGB(red, green, blue));
 }
 
+/// @brief Measure the distance between the colors in the CIELAB color space,
+/// instead of RGB, when approximating them with the palette 256. It is closer
+/// to how they are perceived. The colors already built aren't updated.
+/// @ingroup screen
+void SetPerceptualQuantization(bool enabled) {
+  perceptual_quantization.store(enabled, std::memory_order_relaxed);
+}
+
+}  // namespace ftxui
+
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
 // Use of this source code is governed by the MIT license that can be found in
 // the LICENSE file.
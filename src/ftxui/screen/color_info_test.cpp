@@ -0,0 +1,35 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+
+#include "ftxui/screen/color.hpp"       // for Color
+#include "ftxui/screen/color_info.hpp"  // for ClosestPalette256, GetColorInfo
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(ColorInfoTest, PaletteColorsAreFound) {
+  for (int i = 16; i < 256; ++i) {
+    ColorInfo info = GetColorInfo(Color::Palette256(i));
+    EXPECT_EQ(ClosestPalette256(info.red, info.green, info.blue), i);
+  }
+}
+
+TEST(ColorInfoTest, Closest) {
+  EXPECT_EQ(ClosestPalette256(255, 0, 0), Color::Red1);
+  EXPECT_EQ(ClosestPalette256(250, 5, 3), Color::Red1);
+  EXPECT_EQ(ClosestPalette256(0, 0, 0), Color::Grey0);
+  EXPECT_EQ(ClosestPalette256(255, 255, 255), Color::Grey100);
+  EXPECT_EQ(ClosestPalette256(100, 100, 100), Color::Grey39);
+}
+
+TEST(ColorInfoTest, Perceptual) {
+  SetPerceptualQuantization(true);
+  EXPECT_EQ(ClosestPalette256(255, 0, 0), Color::Red1);
+  EXPECT_EQ(ClosestPalette256(0, 0, 0), Color::Grey0);
+  EXPECT_EQ(ClosestPalette256(255, 255, 255), Color::Grey100);
+  SetPerceptualQuantization(false);
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,14 @@
+#include "ftxui/screen/color_map.hpp"
+
+namespace ftxui {
+
+ColorMap::ColorMap(const std::function<Color(float value)>& color) {
+  for (int i = 0; i < kSize; ++i)
+    colors_[i] = color(float(i) / (kSize - 1));
+}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,65 @@
+#include <mutex>          // for mutex, lock_guard
+#include <string_view>    // for wstring_view
+#include <unordered_map>  // for unordered_map
+
+#include "ftxui/screen/interned_string.hpp"
+#include "ftxui/screen/string.hpp"  // for wstring_width
+
+namespace ftxui {
+
+namespace {
+
+using Data = InternedString::Data;
+
+// The strings in use. An entry is removed when its last copy is destroyed.
+std::mutex& Mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<std::wstring_view, std::weak_ptr<const Data>>& Pool() {
+  static std::unordered_map<std::wstring_view, std::weak_ptr<const Data>> pool;
+  return pool;
+}
+
+void Release(const Data* data) {
+  {
+    std::lock_guard<std::mutex> lock(Mutex());
+    // The entry may already refer to a newer copy of the same content.
+    auto it = Pool().find(data->text);
+    if (it != Pool().end() && it->second.expired())
+      Pool().erase(it);
+  }
+  delete data;
+}
+
+std::shared_ptr<const Data> Intern(const std::wstring& text) {
+  std::lock_guard<std::mutex> lock(Mutex());
+  auto it = Pool().find(text);
+  if (it != Pool().end()) {
+    if (auto data = it->second.lock())
+      return data;
+    Pool().erase(it);
+  }
+
+  std::shared_ptr<const Data> data(new Data{text, wstring_width(text)},
+                                   Release);
+  // The key views the string owned by the entry.
+  Pool().emplace(data->text, data);
+  return data;
+}
+
+}  // namespace
+
+/// @brief The empty string.
+InternedString::InternedString() : InternedString(std::wstring()) {}
+
+/// @brief The string with the content of |text|.
+InternedString::InternedString(const std::wstring& text)
+    : data_(Intern(text)) {}
+
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
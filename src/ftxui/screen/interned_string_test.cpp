@@ -0,0 +1,39 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <string>                   // for allocator, wstring
+
+#include "ftxui/screen/interned_string.hpp"  // for InternedString
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(InternedStringTest, SameContentSameString) {
+  InternedString a = std::wstring(L"OK");
+  InternedString b = std::wstring(L"OK");
+  InternedString c = std::wstring(L"FAILED");
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(&a.str(), &b.str());
+  EXPECT_NE(a, c);
+  EXPECT_EQ(c.str(), L"FAILED");
+}
+
+TEST(InternedStringTest, Width) {
+  EXPECT_EQ(InternedString().width(), 0);
+  EXPECT_EQ(InternedString(L"abc").width(), 3);
+  EXPECT_EQ(InternedString(L"测试").width(), 4);
+}
+
+TEST(InternedStringTest, Reintern) {
+  {
+    InternedString a = std::wstring(L"temporary");
+    EXPECT_EQ(a.width(), 9);
+  }
+  // The first copy was released. A new one is created.
+  InternedString b = std::wstring(L"temporary");
+  EXPECT_EQ(b.str(), L"temporary");
+  EXPECT_EQ(b, InternedString(L"temporary"));
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
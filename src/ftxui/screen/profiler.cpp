@@ -0,0 +1,134 @@
+#include <cstdlib>    // for free
+#include <iomanip>    // for setw, setprecision, fixed
+#include <mutex>      // for mutex, lock_guard
+#include <sstream>    // for stringstream
+#include <typeindex>  // for type_index
+
+#if defined(__GNUC__)
+#include <cxxabi.h>  // for __cxa_demangle
+#endif
+
+#include "ftxui/screen/profiler.hpp"
+
+namespace ftxui {
+namespace profiler {
+
+namespace {
+
+const char* kPhaseNames[kPhaseCount] = {
+    "ComputeRequirement", "SetBox", "Render", "ApplyShader", "ToString",
+};
+
+std::mutex mutex;
+std::array<Timing, kPhaseCount> phases;
+// Demangling the type names is deferred to GetReport().
+std::map<std::type_index, std::array<Timing, kPhaseCount>> nodes;
+
+// The innermost scope of the current thread.
+thread_local Scope* current_scope = nullptr;
+
+std::string Demangle(const char* name) {
+  std::string out = name;
+#if defined(__GNUC__)
+  int status = 0;
+  char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+  if (status == 0) {
+    out = demangled;
+    free(demangled);
+  }
+#endif
+
+  // Most nodes are defined in an anonymous namespace. Don't repeat it.
+  const std::string anonymous = "(anonymous namespace)::";
+  for (auto pos = out.find(anonymous); pos != std::string::npos;
+       pos = out.find(anonymous, pos)) {
+    out.erase(pos, anonymous.size());
+  }
+  return out;
+}
+
+void Print(std::stringstream& ss,
+           const std::string& name,
+           const std::string& phase,
+           const Timing& timing) {
+  if (timing.calls == 0)
+    return;
+  ss << std::left << std::setw(39) << name << " " << std::setw(20) << phase
+     << std::right << std::setw(10) << timing.calls << std::setw(12)
+     << std::fixed << std::setprecision(3) << timing.time.count() / 1e6
+     << " ms" << std::endl;
+}
+
+}  // namespace
+
+/// @brief A table of the timings, one line per phase and per node type.
+std::string Report::ToString() const {
+  std::stringstream ss;
+  for (int i = 0; i < kPhaseCount; ++i)
+    Print(ss, "", kPhaseNames[i], phases[i]);
+  for (auto& it : nodes) {
+    for (int i = 0; i < kPhaseCount; ++i)
+      Print(ss, it.first, kPhaseNames[i], it.second[i]);
+  }
+  return ss.str();
+}
+
+/// @brief Whether FTXUI was built with the option FTXUI_ENABLE_PROFILING.
+bool Enabled() {
+#if defined(FTXUI_ENABLE_PROFILING)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/// @brief The timings measured since the last call to Reset().
+Report GetReport() {
+  std::lock_guard<std::mutex> lock(mutex);
+  Report report;
+  report.phases = phases;
+  for (auto& it : nodes) {
+    auto& timings = report.nodes[Demangle(it.first.name())];
+    for (int i = 0; i < kPhaseCount; ++i) {
+      timings[i].calls += it.second[i].calls;
+      timings[i].time += it.second[i].time;
+    }
+  }
+  return report;
+}
+
+/// @brief Forget the timings measured so far.
+void Reset() {
+  std::lock_guard<std::mutex> lock(mutex);
+  phases = {};
+  nodes.clear();
+}
+
+Scope::Scope(Phase phase, const std::type_info* type)
+    : phase_(phase),
+      type_(type),
+      start_(std::chrono::steady_clock::now()),
+      parent_(current_scope) {
+  current_scope = this;
+}
+
+Scope::~Scope() {
+  auto time = std::chrono::steady_clock::now() - start_;
+  current_scope = parent_;
+  if (parent_)
+    parent_->children_time_ += time;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  Timing& timing = type_ ? nodes[std::type_index(*type_)][int(phase_)]
+                         : phases[int(phase_)];
+  timing.calls++;
+  // A node is accounted for its own time. A phase for the whole time.
+  timing.time += type_ ? time - children_time_ : time;
+}
+
+}  // namespace profiler
+}  // namespace ftxui
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,52 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <chrono>                   // for milliseconds
+#include <string>                   // for allocator, basic_string, string
+#include <thread>                   // for sleep_for
+
+#include "ftxui/screen/profiler.hpp"  // for Scope, Phase, GetReport, Reset
+#include "gtest/gtest_pred_impl.h"    // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+struct Parent {};
+struct Child {};
+}  // namespace
+
+TEST(ProfilerTest, NodesAreAccountedForTheirOwnTime) {
+  using namespace std::chrono_literals;
+  profiler::Reset();
+  {
+    profiler::Scope phase(profiler::Phase::Render);
+    profiler::Scope parent(profiler::Phase::Render, &typeid(Parent));
+    for (int i = 0; i < 2; ++i) {
+      profiler::Scope child(profiler::Phase::Render, &typeid(Child));
+      std::this_thread::sleep_for(10ms);
+    }
+  }
+
+  auto report = profiler::GetReport();
+  auto& render = report.phases[int(profiler::Phase::Render)];
+  EXPECT_EQ(render.calls, 1);
+  EXPECT_GE(render.time, 20ms);
+
+  ASSERT_EQ(report.nodes.size(), 2u);
+  for (auto& it : report.nodes) {
+    auto& timing = it.second[int(profiler::Phase::Render)];
+    if (it.first.find("Child") != std::string::npos) {
+      EXPECT_EQ(timing.calls, 2);
+      EXPECT_GE(timing.time, 20ms);
+    } else {
+      EXPECT_EQ(timing.calls, 1);
+      EXPECT_LT(timing.time, 10ms);
+    }
+  }
+
+  profiler::Reset();
+  EXPECT_EQ(profiler::GetReport().nodes.size(), 0u);
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
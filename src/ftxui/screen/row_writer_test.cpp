@@ -0,0 +1,51 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+
+#include "ftxui/dom/sub_screen.hpp"  // for SubScreen
+#include "ftxui/screen/box.hpp"      // for Box
+#include "ftxui/screen/screen.hpp"   // for RowWriter, Screen
+#include "gtest/gtest_pred_impl.h"   // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+TEST(RowWriterTest, Write) {
+  Screen screen(4, 2);
+  RowWriter row(screen, 1, 1, 2);
+  EXPECT_EQ(row.x_min(), 1);
+  EXPECT_EQ(row.x_max(), 2);
+  row.at(1) = L'a';
+  row.at(2) = L'b';
+  EXPECT_EQ(
+      "    \r\n"
+      " ab ",
+      screen.ToString());
+}
+
+TEST(RowWriterTest, ClippedByStencil) {
+  Screen screen(4, 2);
+  screen.stencil = {1, 2, 0, 0};
+
+  RowWriter row(screen, 0, -5, 10);
+  EXPECT_EQ(row.x_min(), 1);
+  EXPECT_EQ(row.x_max(), 2);
+  EXPECT_FALSE(row.Contain(0));
+  EXPECT_TRUE(row.Contain(1));
+  EXPECT_FALSE(row.Contain(3));
+
+  RowWriter outside(screen, 1, 0, 3);
+  EXPECT_GT(outside.x_min(), outside.x_max());
+  EXPECT_FALSE(outside.Contain(0));
+}
+
+TEST(RowWriterTest, Origin) {
+  SubScreen screen(Box{10, 12, 5, 6});
+  RowWriter row(screen, 6, 0, 11);
+  EXPECT_EQ(row.x_min(), 10);
+  EXPECT_EQ(row.x_max(), 11);
+  row.at(11) = L'x';
+  EXPECT_EQ(screen.at(11, 6), L'x');
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -4,6 +4,7 @@
 
 #include "ftxui/dom/node.hpp"         // for Element, Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/profiler.hpp"  // for Scope, Phase
 #include "ftxui/screen/screen.hpp"
 #include "ftxui/screen/string.hpp"    // for to_string, wchar_width
 #include "ftxui/screen/terminal.hpp"  // for Terminal::Dimensions, Terminal
@@ -43,7 +44,9 @@ bool In(const Box& stencil, int x, int y) {
          stencil.y_min <= y && y <= stencil.y_max;
 }
 
-Pixel dev_null_pixel;
+// Written to when drawing outside of the stencil. One per thread, so that
+// several threads can draw into disjoint parts of a screen.
+thread_local Pixel dev_null_pixel;
 
 #if defined(_WIN32)
 void WindowsEmulateVT100Terminal() {
@@ -95,6 +98,23 @@ void UpdatePixelStyle(std::wstringstream& ss, Pixel& previous, Pixel& next) {
 
 }  // namespace
 
+/// @return whether both pixels are displayed identically.
+bool Pixel::operator==(const Pixel& other) const {
+  return character == other.character &&                //
+         background_color == other.background_color &&  //
+         foreground_color == other.foreground_color &&  //
+         blink == other.blink &&                        //
+         bold == other.bold &&                          //
+         dim == other.dim &&                            //
+         inverted == other.inverted &&                  //
+         underlined == other.underlined;
+}
+
+/// @return whether the pixels are displayed differently.
+bool Pixel::operator!=(const Pixel& other) const {
+  return !operator==(other);
+}
+
 /// A fixed dimension.
 /// @see Fit
 /// @see Full
@@ -102,7 +122,8 @@ Dimension Dimension::Fixed(int v) {
   return Dimension{v, v};
 }
 
-/// The minimal dimension that will fit the given element.
+/// The minimal dimension that will fit the given element. The element is
+/// measured: use RenderMeasured to draw it without measuring it again.
 /// @see Fixed
 /// @see Full
 Dimension Dimension::Fit(Element& e) {
@@ -152,6 +173,9 @@ Screen::Screen(int dimx, int dimy)
 /// Produce a std::string that can be used to print the Screen on the terminal.
 /// Don't forget to flush stdout. Alternatively, you can use Screen::Print();
 std::string Screen::ToString() {
+#if defined(FTXUI_ENABLE_PROFILING)
+  profiler::Scope scope(profiler::Phase::ToString);
+#endif
   std::wstringstream ss;
 
   Pixel previous_pixel;
@@ -195,7 +219,18 @@ wchar_t& Screen::at(int x, int y) {
 /// @param x The pixel position along the x-axis.
 /// @param y The pixel position along the y-axis.
 Pixel& Screen::PixelAt(int x, int y) {
-  return In(stencil, x, y) ? pixels_[y][x] : dev_null_pixel;
+  return In(stencil, x, y) ? pixels_[y - origin_y_][x - origin_x_]
+                            : dev_null_pixel;
+}
+
+RowWriter::RowWriter(Screen& screen, int y, int x_min, int x_max) {
+  const Box& stencil = screen.stencil;
+  if (y < stencil.y_min || y > stencil.y_max)
+    return;
+  x_min_ = std::max(x_min, stencil.x_min);
+  x_max_ = std::min(x_max, stencil.x_max);
+  row_ = screen.pixels_[y - screen.origin_y_].data();
+  origin_x_ = screen.origin_x_;
 }
 
 /// @brief Return a string to be printed in order to reset the cursor position
@@ -206,7 +241,7 @@ Pixel& Screen::PixelAt(int x, int y) {
 /// while(true) {
 ///   auto document = render();
 ///   auto screen = Screen::Create(Dimension::Full(), Dimension::Fit(document));
-///   Render(screen, document);
+///   RenderMeasured(screen, document);
 ///   std::cout << reset_position << screen.ToString() << std::flush;
 ///   reset_position = screen.ResetPosition();
 ///
@@ -243,12 +278,16 @@ void Screen::Clear() {
 
 // clang-format off
 void Screen::ApplyShader() {
+#if defined(FTXUI_ENABLE_PROFILING)
+  profiler::Scope scope(profiler::Phase::ApplyShader);
+#endif
+
   // Merge box characters togethers.
   for (int y = 1; y < dimy_; ++y) {
     for (int x = 1; x < dimx_; ++x) {
-      wchar_t& left = at(x - 1, y);
-      wchar_t& top = at(x, y - 1);
-      wchar_t& cur = at(x, y);
+      wchar_t& left = pixels_[y][x - 1].character[0];
+      wchar_t& top = pixels_[y - 1][x].character[0];
+      wchar_t& cur = pixels_[y][x].character[0];
 
       // Left vs current
       if (cur == U'│' && left == U'─') cur = U'┤';
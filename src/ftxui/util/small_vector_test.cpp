@@ -0,0 +1,106 @@
+#include <gtest/gtest-message.h>    // for Message
+#include <gtest/gtest-test-part.h>  // for TestPartResult
+#include <memory>                   // for make_shared, shared_ptr
+#include <stdexcept>                // for out_of_range
+#include <string>                   // for string, to_string
+#include <type_traits>              // for is_nothrow_move_constructible
+#include <utility>                  // for move
+#include <vector>                   // for vector
+
+#include "ftxui/util/small_vector.hpp"  // for SmallVector
+#include "gtest/gtest_pred_impl.h"  // for Test, SuiteApiResolver, EXPECT_EQ
+
+using namespace ftxui;
+
+namespace {
+
+using Vector = SmallVector<std::string, 2>;
+
+std::vector<std::string> Content(const Vector& vector) {
+  return std::vector<std::string>(vector.begin(), vector.end());
+}
+
+}  // namespace
+
+TEST(SmallVectorTest, InlineToHeap) {
+  Vector vector;
+  vector.push_back("a");
+  vector.push_back("b");
+  const std::string* inline_data = vector.data();
+  vector.push_back("c");
+  EXPECT_NE(vector.data(), inline_data);
+  EXPECT_EQ(Content(vector), std::vector<std::string>({"a", "b", "c"}));
+
+  Vector from_vector(std::vector<std::string>{"a", "b", "c"});
+  EXPECT_EQ(Content(from_vector), Content(vector));
+}
+
+TEST(SmallVectorTest, Move) {
+  static_assert(std::is_nothrow_move_constructible<Vector>::value, "");
+
+  for (int size : {1, 3}) {
+    Vector vector;
+    for (int i = 0; i < size; ++i)
+      vector.push_back(std::to_string(i));
+    Vector moved = std::move(vector);
+    EXPECT_EQ(moved.size(), size_t(size));
+    EXPECT_EQ(moved.back(), std::to_string(size - 1));
+    EXPECT_TRUE(vector.empty());
+
+    vector = std::move(moved);
+    EXPECT_EQ(vector.size(), size_t(size));
+    EXPECT_TRUE(moved.empty());
+  }
+}
+
+TEST(SmallVectorTest, SelfMove) {
+  for (int size : {1, 3}) {
+    Vector vector;
+    for (int i = 0; i < size; ++i)
+      vector.push_back(std::to_string(i));
+    Vector& self = vector;
+    vector = std::move(self);
+    EXPECT_EQ(vector.size(), size_t(size));
+    EXPECT_EQ(vector.front(), "0");
+  }
+}
+
+TEST(SmallVectorTest, ClearThenReuse) {
+  auto element = std::make_shared<int>(0);
+  SmallVector<std::shared_ptr<int>, 2> vector;
+  vector.push_back(element);
+  vector.push_back(element);
+  vector.push_back(element);
+  vector.clear();
+  // The elements are released, inline ones included.
+  EXPECT_EQ(element.use_count(), 1);
+  EXPECT_TRUE(vector.empty());
+
+  vector.push_back(element);
+  EXPECT_EQ(vector.size(), 1u);
+  EXPECT_EQ(vector[0], element);
+}
+
+TEST(SmallVectorTest, VectorApi) {
+  for (Vector vector : {Vector{"b", "d"}, Vector{"b", "d", "e"}}) {
+    EXPECT_EQ(*vector.insert(vector.begin(), "a"), "a");
+    EXPECT_EQ(*vector.insert(vector.begin() + 2, "c"), "c");
+    EXPECT_EQ(vector.emplace_back(3, 'f'), "fff");
+    EXPECT_EQ(vector.at(1), "b");
+    EXPECT_THROW(vector.at(vector.size()), std::out_of_range);
+
+    EXPECT_EQ(*vector.erase(vector.begin()), "b");
+    std::string* next = vector.erase(vector.begin() + 1, vector.end());
+    EXPECT_EQ(next, vector.end());
+    EXPECT_EQ(Content(vector), std::vector<std::string>({"b"}));
+
+    vector.resize(3);
+    EXPECT_EQ(Content(vector), std::vector<std::string>({"b", "", ""}));
+    vector.resize(1);
+    EXPECT_EQ(Content(vector), std::vector<std::string>({"b"}));
+  }
+}
+
+// Copyright 2021 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.